@@ -187,7 +187,7 @@ typedef NodeVR<RW2State> RW2Node;
 
 // Nodes for RW2.
 typedef NodesNF1S<RW2State> RW2NodesBase;
-typedef NodesNF_VR<RW2State> RW2Nodes;
+typedef NodesNF_VRA<RW2State> RW2Nodes;	// States of all nodes stored as arrays.
 
 // Link for RW2.
 // 	not necessary because links here are state-less with max_delay=1.
@@ -189,7 +189,7 @@ typedef NodeVR<RW2State> RW2Node;
 
 // Nodes for RW2.
 typedef NodesNF1S<RW2State> RW2NodesBase;
-typedef NodesNF_VR<RW2State> RW2Nodes;
+typedef NodesNF_VRA<RW2State> RW2Nodes;	// States of all nodes stored as arrays.
 
 // Link for RW2.
 // 	not necessary because links here are state-less with max_delay=1.
@@ -295,6 +295,9 @@ class Ex2Network: public Network2<RW2State> {
 	PointSet neighbor_states;
 	// Set of neighbors. (for SG)
 	NodeIDSSet neighbors;
+	// Vertices connected to a node (memory is reused; for rewiring links and node update).
+	NeighborVector deps_sg;
+	NeighborVector deps_ag;
 	// A vector that contains the occupancy information of the state space. (for SG)
 	// This should be updated whenever a node changes its state.
 	vector<NodeIDSSet> occupancy;
@@ -0,0 +1,285 @@
+//
+//	CONETSIM - AdjList.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+#ifndef ADJLIST_H
+#define ADJLIST_H
+
+#include "Types.h"
+#include "HashIndex.h"
+#include <algorithm>
+
+namespace conet {
+
+// Adjacency list of a vertex: a sorted array of (neighbor, multiplicity) pairs.
+// Small lists (up to NLOCAL distinct neighbors) are stored inside the object,
+//	and larger ones in one array on the heap (grown by doubling), so adding and
+//	removing edges does not allocate memory in most cases.
+// Memory is kept when edges are removed (use shrink() to release it).
+// A list with many neighbors (hub) can use a hash index (set_hub), then finding, adding
+//	and removing edges are O(1); pairs are not kept sorted then, and they are sorted
+//	again only by sort() (const functions never change the list, so it can be read
+//	by many threads at once).
+class AdjList {
+   public :
+	// Pair of a neighbor and the number of edges to it.
+	struct Entry {
+		NodeID id;
+		long count;
+	};
+
+	// Constructors.
+	AdjList() : data(local), ndistinct(0), capacity(NLOCAL), total(0), hub(0) {};
+	AdjList(const AdjList &a) : data(local), ndistinct(0), capacity(NLOCAL), total(0), hub(0) {
+		*this=a;
+	};
+
+	// Destructor.
+	~AdjList() {
+		if (data!=local) delete [] data;
+		delete hub;
+	};
+
+	// Assignment.
+	AdjList & operator=(const AdjList &a) {
+		if (&a==this) return *this;
+		delete hub;
+		hub=0;
+		this->reserve(a.ndistinct);
+		std::copy(a.data,a.data+a.ndistinct,data);
+		ndistinct=a.ndistinct;
+		total=a.total;
+		if (a.hub) this->set_hub(true);
+		return *this;
+	};
+
+	// Get the number of edges (multilinks counted).
+	long size() const {
+		return total;
+	};
+
+	// Get the number of distinct neighbors.
+	long distinct() const {
+		return ndistinct;
+	};
+
+	// Check if the list is empty.
+	bool empty() const {
+		return !ndistinct;
+	};
+
+	// Iterators for the pairs (sorted by neighbors unless if_sorted() is false).
+	const Entry * begin() const {
+		return data;
+	};
+	const Entry * end() const {
+		return data+ndistinct;
+	};
+
+	// Find the number of edges to the given neighbor (0 if none).
+	long count(NodeID v) const {
+		if (hub) {
+			long i=hub->pos.find(v);
+			return (i>=0)? data[i].count : 0;
+		};
+		const Entry *p=this->lower(v);
+		if (p!=data+ndistinct && p->id==v) return p->count;
+		else return 0;
+	};
+
+	// Add n edges to the given neighbor.
+	void insert(NodeID v, long n=1) {
+		if (hub) {
+			long i=hub->pos.find(v);
+			if (i>=0)
+				data[i].count+=n;
+			else {
+				// Added at the end.
+				if (ndistinct==capacity) this->reserve(2*capacity);
+				if (ndistinct && data[ndistinct-1].id>v) hub->sorted=false;
+				data[ndistinct].id=v;
+				data[ndistinct].count=n;
+				hub->pos.insert(v,ndistinct);
+				ndistinct++;
+			};
+			total+=n;
+			return;
+		};
+		Entry *p=this->lower(v);
+		if (p!=data+ndistinct && p->id==v)
+			p->count+=n;
+		else {
+			long pos=p-data;
+			if (ndistinct==capacity) {
+				this->reserve(2*capacity);
+				p=data+pos;
+			};
+			std::copy_backward(p,data+ndistinct,data+ndistinct+1);
+			p->id=v;
+			p->count=n;
+			ndistinct++;
+		};
+		total+=n;
+	};
+
+	// Remove one edge to the given neighbor (returns false if it doesn't exist).
+	bool erase(NodeID v) {
+		if (hub) {
+			long i=hub->pos.find(v);
+			if (i<0) return false;
+			if (--data[i].count==0) {
+				// The last pair is moved to the empty position.
+				hub->pos.erase(v);
+				ndistinct--;
+				if (i<ndistinct) {
+					data[i]=data[ndistinct];
+					hub->pos.insert(data[i].id,i);
+					hub->sorted=false;
+				};
+			};
+			total--;
+			return true;
+		};
+		Entry *p=this->lower(v);
+		if (p==data+ndistinct || p->id!=v) return false;
+		if (--(p->count)==0) {
+			std::copy(p+1,data+ndistinct,p);
+			ndistinct--;
+		};
+		total--;
+		return true;
+	};
+
+	// Remove all edges (memory is kept).
+	void clear() {
+		ndistinct=0;
+		total=0;
+		if (hub) {
+			hub->pos.clear();
+			hub->sorted=true;
+		};
+	};
+
+	// Use (or stop using) the hash index.
+	void set_hub(bool h) {
+		if (h==(hub!=0)) return;
+		if (h) {
+			hub=new Hub;
+			hub->pos.reserve(ndistinct);
+			this->sort_hub();
+		}
+		else {
+			if (!hub->sorted) this->sort_hub();
+			delete hub;
+			hub=0;
+		};
+	};
+
+	// Check if the hash index is used.
+	bool if_hub() const {
+		return hub!=0;
+	};
+
+	// Check if pairs are sorted (only a hub changed after the last sort() is not sorted).
+	bool if_sorted() const {
+		return !hub || hub->sorted;
+	};
+
+	// Sort pairs of a hub (if changed).
+	void sort() {
+		if (hub && !hub->sorted) this->sort_hub();
+	};
+
+	// Make sure there is a space for n distinct neighbors.
+	void reserve(long n) {
+		if (n<=capacity) return;
+		Entry *p=new Entry[n];
+		std::copy(data,data+ndistinct,p);
+		if (data!=local) delete [] data;
+		data=p;
+		capacity=n;
+	};
+
+	// Release the memory not used.
+	void shrink() {
+		if (data==local || ndistinct==capacity) return;
+		Entry *p=(ndistinct<=NLOCAL)? local : new Entry[ndistinct];
+		std::copy(data,data+ndistinct,p);
+		delete [] data;
+		data=p;
+		capacity=(ndistinct<=NLOCAL)? long(NLOCAL) : ndistinct;
+	};
+
+   private:
+	// Hash index for a hub (neighbor -> position of its pair).
+	struct Hub {
+		HashIndex pos;
+		bool sorted;	// Whether pairs are sorted.
+	};
+
+	static bool less_id(const Entry &a, const Entry &b) {
+		return a.id<b.id;
+	};
+
+	// Sort pairs of a hub, and update the index.
+	void sort_hub() {
+		std::sort(data,data+ndistinct,less_id);
+		for (long i=0;i<ndistinct;i++)
+			hub->pos.insert(data[i].id,i);
+		hub->sorted=true;
+	};
+
+	// Find the first pair whose neighbor is not less than v (binary search).
+	Entry * lower(NodeID v) const {
+		Entry *first=data;
+		long len=ndistinct;
+		while (len>0) {
+			long half=len/2;
+			if (first[half].id<v) {
+				first+=half+1;
+				len-=half+1;
+			}
+			else
+				len=half;
+		};
+		return first;
+	};
+
+	// Number of pairs stored inside the object.
+	static const long NLOCAL=4;
+
+	Entry local[NLOCAL];	// Storage for small lists.
+	Entry *data;		// Points to local or an array on the heap.
+	long ndistinct;		// Number of pairs.
+	long capacity;		// Number of pairs that can be stored in data.
+	long total;		// Number of edges (sum of multiplicities).
+	Hub *hub;		// Hash index (0 if not used).
+};
+
+// Vertex and number of edges of a pair (used by visit_deps in NeighborVisitor.h).
+inline NodeID dep_vertex(const AdjList::Entry &e) {
+	return e.id;
+};
+inline long dep_count(const AdjList::Entry &e) {
+	return e.count;
+};
+
+}; // End of namespace conet.
+#endif
@@ -0,0 +1,105 @@
+//
+//	CONETSIM - ComponentTracker.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef COMPONENTTRACKER_H
+#define COMPONENTTRACKER_H
+
+#include "Graph.h"
+#include "GraphObserver.h"
+#include "Types.h"
+#include <vector>
+#include <map>
+
+namespace conet {
+
+// Connected components of a graph (weakly connected ones for digraphs) updated for each
+//	added or removed edge, so that the number of components and the size of the largest
+//	component can be found at every time step without searching the whole graph.
+// A spanning forest of the graph is kept with a label for each vertex:
+//	- Adding an edge between two components joins them (the smaller one is relabeled).
+//	- Removing the last edge between two vertices matters only if it is in the forest;
+//	  then the smaller of two split trees is searched for a replacement edge, and gets a
+//	  new label only when there is none.
+// When the graph is changed in other ways (cleared, copied, read, vertices changed),
+//	components are found again from scratch when they are needed next time.
+// The tracker attaches itself to the graph (Graph::set_observer) and detaches when
+//	destroyed; the graph should exist while the tracker is used.
+class ComponentTracker : public GraphObserver {
+   public :
+	// Constructor (components are found when they are needed first).
+	ComponentTracker(Graph &g);
+
+	// Destructor.
+	~ComponentTracker();
+
+	// Get the number of components.
+	long get_ncomponents();
+
+	// Get the size of the largest component (0 for an empty graph).
+	long get_giant_size();
+
+	// Find the label of the component of a given vertex (-1 if it doesn't exist).
+	// (Labels can change when edges are changed.)
+	long find_component(NodeID v);
+
+	// Find the size of the component of a given vertex (0 if it doesn't exist).
+	long find_component_size(NodeID v);
+
+	// Check if two vertices are in the same component.
+	bool if_connected(NodeID v1, NodeID v2);
+
+	// Functions called by the graph.
+	void edge_added(NodeID ori, NodeID des);
+	void edge_removed(NodeID ori, NodeID des);
+	void graph_changed() {
+		dirty=true;
+	};
+
+   private:
+	// Find all components from scratch.
+	void rebuild();
+
+	// Change the size of a component (sizes of components are counted in size_count).
+	void set_size(long label, long size);
+
+	// Change labels of vertices in the tree of a given slot (with the label old) to label.
+	void relabel(long slot, long old, long label);
+
+	// Add or remove an edge of the forest.
+	void add_tree_edge(long s1, long s2);
+	bool remove_tree_edge(long s1, long s2);
+
+	Graph &gr;
+	bool dirty;				// Whether components should be found again.
+	std::vector<NodeID> ids;		// Vertex in each slot (-1 if not used).
+	std::vector<long> labels;		// Label of the component of each slot (-1 if not used).
+	std::vector<long> sizes;		// Size of each component (indexed by labels).
+	std::vector<long> free_labels;		// Labels not used.
+	std::map<long,long> size_count;		// Number of components for each size.
+	long ncomponents;			// Number of components.
+	std::vector<std::vector<long> > tree;	// Edges of the spanning forest (slots).
+	std::vector<long> marks;		// Marks of slots used in searches.
+	long stamp;				// Mark of the current search.
+};
+
+}; // End of namespace conet.
+#endif
@@ -0,0 +1,82 @@
+//
+//	CONETSIM - DegreeCounts.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef DEGREECOUNTS_H
+#define DEGREECOUNTS_H
+
+#include <vector>
+
+namespace conet {
+
+// Degrees of vertices (number of edges and number of distinct neighbors, loops not
+//	counted as neighbors) updated whenever an edge is added or removed,
+//	so that degree queries are O(1) even with multilinks.
+class DegreeCounts {
+   public :
+	// Constructor (n: number of vertices).
+	DegreeCounts(long n=0) : total(n,0), distinct(n,0) {};
+
+	// Change the number of vertices (new vertices have no edges).
+	void resize(long n) {
+		total.resize(n,0);
+		distinct.resize(n,0);
+	};
+
+	// Set all degrees to zero.
+	void clear() {
+		total.assign(total.size(),0);
+		distinct.assign(distinct.size(),0);
+	};
+
+	// An edge of v is added (new_neighbor: the other end just became a neighbor of v).
+	void add(long v, bool new_neighbor) {
+		total[v]++;
+		if (new_neighbor) distinct[v]++;
+	};
+
+	// An edge of v is removed (lost_neighbor: the other end is not a neighbor of v any more).
+	void remove(long v, bool lost_neighbor) {
+		total[v]--;
+		if (lost_neighbor) distinct[v]--;
+	};
+
+	// Get the degree of v (the number of neighbors if neighbor=true).
+	long get(long v, bool neighbor=false) const {
+		return neighbor? distinct[v] : total[v];
+	};
+
+	// Copy degrees of all vertices to a vector (returns the maximum degree).
+	long find_all(std::vector<long> &degree, bool neighbor=false) const {
+		degree=neighbor? distinct : total;
+		long max=0;
+		for (unsigned long i=0;i<degree.size();i++)
+			if (degree[i]>max) max=degree[i];
+		return max;
+	};
+
+   private:
+	std::vector<long> total;	// Number of edges (multilinks counted).
+	std::vector<long> distinct;	// Number of neighbors.
+};
+
+}; // End of namespace conet.
+#endif
@@ -0,0 +1,78 @@
+//
+//	CONETSIM - DirectionBFS.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef DIRECTIONBFS_H
+#define DIRECTIONBFS_H
+
+#include "Graph.h"
+#include "Types.h"
+#include <vector>
+
+namespace conet {
+
+// Direction-optimizing breadth-first search from a single source.
+// Each layer is found either top-down (outward connected vertices of the current layer
+//	are visited) or bottom-up (each vertex not found yet checks its inward connected
+//	vertices, and stops at the first one in the current layer, which is kept as a bitmap).
+// The search switches to bottom-up when the current layer has more than 1/ALPHA of the
+//	edges not checked yet, and back to top-down when the layer has fewer than 1/BETA of
+//	the vertices, so large low-diameter graphs are searched with far fewer edges read.
+// Neighbors are read through Graph::for_each_out_dep and for_each_in_dep (for GraphFD,
+//	from gra_out and gra), and data for vertices are indexed by slots (Graph::find_slot).
+// The same object can be used for many searches (arrays are reused).
+class DirectionBFS {
+   public :
+	// Constructor (the graph should not be changed while this object is used).
+	DirectionBFS(const Graph &g);
+
+	// Search from a given vertex (only up to distance max_dist when max_dist>=0).
+	// Returns the largest distance found (-1 if the vertex doesn't exist).
+	long search(NodeID source, long max_dist=-1);
+
+	// Get the distances found by the last search, indexed by slots (-1 if not reached).
+	const std::vector<long> & get_distances() const {
+		return dist;
+	};
+
+	// Get the vertices found by the last search in the order of visits (source first).
+	const std::vector<NodeID> & get_order() const {
+		return order;
+	};
+
+	// Parameters for switching directions.
+	static const long ALPHA=14;
+	static const long BETA=24;
+
+   private:
+	// Find the next layer (with distance d) from the layer order[begin..end-1].
+	void step_top_down(long begin, long end, long d);
+	void step_bottom_up(long begin, long end, long d);
+
+	const Graph &gr;
+	std::vector<long> dist;			// Distance of each slot (-1 if not found).
+	std::vector<NodeID> order;		// Vertices found (in the order of visits).
+	std::vector<unsigned long> frontier;	// Bitmap of slots in the current layer.
+	std::vector<NodeID> ids;		// Vertex in each slot (-1 if not used; for bottom-up steps).
+};
+
+}; // End of namespace conet.
+#endif
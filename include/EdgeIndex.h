@@ -0,0 +1,148 @@
+//
+//	CONETSIM - EdgeIndex.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+#ifndef EDGEINDEX_H
+#define EDGEINDEX_H
+
+#include "Types.h"
+#include "HashIndex.h"
+#include <vector>
+
+namespace conet {
+
+// Table of end points (ori, des) of links indexed by LinkID.
+// IDs are usually given densely (0, 1, 2,...), so they are stored in vectors indexed by ID;
+//	only IDs much larger than the number of links are stored through a hash table.
+class EdgeIndex {
+   public :
+	// Constructor.
+	EdgeIndex() : nlinks(0) {};
+
+	// Get the number of links.
+	long size() const {
+		return nlinks;
+	};
+
+	// Find the end points of a link (returns false if it doesn't exist).
+	bool find(LinkID id, NodeID &ori, NodeID &des) const {
+		if (id<0) return false;
+		if (id<long(oris.size())) {
+			if (oris[id]<0) return false;
+			ori=oris[id];
+			des=dess[id];
+			return true;
+		};
+		long pos=sparse.find(id);
+		if (pos<0) return false;
+		ori=sparse_oris[pos];
+		des=sparse_dess[pos];
+		return true;
+	};
+
+	// Insert a link (returns false if the ID already exists or is negative).
+	bool insert(LinkID id, NodeID ori, NodeID des) {
+		NodeID o, d;
+		if (id<0 || this->find(id,o,d)) return false;
+		// Make the dense part larger if the ID is not too large.
+		if (id>=long(oris.size()) && id<2*nlinks+MIN_DENSE)
+			this->grow(id+1>2*long(oris.size())? id+1 : 2*oris.size());
+		if (id<long(oris.size())) {
+			oris[id]=ori;
+			dess[id]=des;
+		}
+		else {
+			long pos;
+			if (free_pos.empty()) {
+				pos=sparse_oris.size();
+				sparse_oris.push_back(ori);
+				sparse_dess.push_back(des);
+			}
+			else {
+				pos=free_pos.back();
+				free_pos.pop_back();
+				sparse_oris[pos]=ori;
+				sparse_dess[pos]=des;
+			};
+			sparse.insert(id,pos);
+		};
+		nlinks++;
+		return true;
+	};
+
+	// Remove a link (returns false if it doesn't exist).
+	bool erase(LinkID id) {
+		if (id<0) return false;
+		if (id<long(oris.size())) {
+			if (oris[id]<0) return false;
+			oris[id]=-1;
+		}
+		else {
+			long pos=sparse.find(id);
+			if (pos<0) return false;
+			sparse.erase(id);
+			free_pos.push_back(pos);
+		};
+		nlinks--;
+		return true;
+	};
+
+	// Remove all links.
+	void clear() {
+		oris.clear();
+		dess.clear();
+		sparse.clear();
+		sparse_oris.clear();
+		sparse_dess.clear();
+		free_pos.clear();
+		nlinks=0;
+	};
+
+   private:
+	// IDs smaller than 2*size()+MIN_DENSE are stored in the dense part.
+	static const long MIN_DENSE=1024;
+
+	// Make the dense part of size n (links in the hash table are moved if possible).
+	void grow(long n) {
+		oris.resize(n,-1);
+		dess.resize(n,-1);
+		std::vector<long> ids;
+		sparse.find_keys(ids);
+		for (unsigned long i=0;i<ids.size();i++)
+			if (ids[i]<n) {
+				long pos=sparse.find(ids[i]);
+				oris[ids[i]]=sparse_oris[pos];
+				dess[ids[i]]=sparse_dess[pos];
+				sparse.erase(ids[i]);
+				free_pos.push_back(pos);
+			};
+	};
+
+	long nlinks;			// Number of links.
+	std::vector<NodeID> oris;	// Dense part: origin for each ID (-1 if not used).
+	std::vector<NodeID> dess;	// Dense part: destination for each ID.
+	HashIndex sparse;		// Sparse part: ID -> position in sparse_oris/sparse_dess.
+	std::vector<NodeID> sparse_oris;
+	std::vector<NodeID> sparse_dess;
+	std::vector<long> free_pos;	// Free positions in the sparse part.
+};
+
+}; // End of namespace conet.
+#endif
@@ -56,6 +56,7 @@ struct Bad_Input_Type {}; // Time for input is bad.
 struct TimeSeq_Range_Error {}; // Not allowed value of t is used.
 struct TimeSeq_Size_Set {};	// DRing size should be set only once.
 struct TimeSeq_Size_Not_Set {};	// DRing size should be set only once.
+struct TimeSeq_Capacity_Error {};	// Size is greater than the capacity of TimeSeqFixed.
 
 // For Nodes and Links
 struct Bad_Node_ID {};
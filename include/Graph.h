@@ -24,16 +24,30 @@
 #define GRAPH_H
 
 #include "Types.h"
+#include "VertexIndex.h"
+#include "NeighborVisitor.h"
+#include "GraphObserver.h"
 
 #include <set>
 #include <map>
 #include <vector>
+#include <utility>
 #include <istream>
 #include <ostream>
 #include <iostream>
 
 namespace conet {
 
+class SlotLists;
+
+// Value estimated from random samples, with its error (half width of the 95% confidence
+//	interval) and the number of samples used.
+struct Estimate {
+	double value;
+	double error;
+	long nsamples;
+};
+
 // An abstract base class that represents a graph (vertex=node, edge=link).
 // It only contains basic operations for graphs. 
 //
@@ -77,7 +91,20 @@ class Graph {
    public :
 	// Constructors.
    	Graph(LinkType lt=0, bool l=false, bool m=false) 
-		: nedges(0), edge_type(lt), loop(l), multi_link(m) {};
+		: nedges(0), edge_type(lt), loop(l), multi_link(m), observer(0) {};
+	// (The observer is not copied.)
+	Graph(const Graph &gr) : nedges(gr.nedges), edge_type(gr.edge_type), loop(gr.loop), \
+		multi_link(gr.multi_link), observer(0) {};
+
+	// Assignment (the observer is kept).
+	Graph & operator=(const Graph &gr) {
+		nedges=gr.nedges;
+		edge_type=gr.edge_type;
+		loop=gr.loop;
+		multi_link=gr.multi_link;
+		this->notify_changed();
+		return *this;
+	};
 	
 	// Virtual destructor.
 	virtual ~Graph() {};
@@ -141,6 +168,17 @@ class Graph {
 		multi_link=ml;
 	};
 
+	// Set the observer that is told about changes of edges (0: no observer).
+	// (Only one observer can be attached; it is not owned by the graph.)
+	void set_observer(GraphObserver *o) {
+		observer=o;
+	};
+
+	// Get the observer (0 if none).
+	GraphObserver * get_observer() const {
+		return observer;
+	};
+
 	// Get if nodes are fixed.
 	virtual bool if_nodes_fixed() const=0;
 
@@ -156,6 +194,12 @@ class Graph {
 	// Find if the given vertex exists.
 	virtual bool find_vertex(NodeID v) const=0;
 
+	// Get the number of slots and find the slot of a given vertex (-1 if it doesn't exist).
+	// Slots are dense indices (from 0 to get_slot_size()-1) of vertices,
+	//	so that data for vertices can be stored in arrays during calculations.
+	virtual long get_slot_size() const=0;
+	virtual long find_slot(NodeID v) const=0;
+
 	// Find the set of all current edges (only works when there are edge states, classes that ends with S).
 	virtual bool find_all_edges(LinkIDSet &edgeset) const=0;
 	
@@ -164,6 +208,12 @@ class Graph {
 	virtual bool find_edge(NodeID ori, NodeID des)=0;
 	virtual bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const=0; // only works when there are edge states, classes that ends with S.
 
+	// Find the end points of an edge with a given ID (classes that ends with S only).
+	// Returns false if the edge doesn't exist.
+	virtual bool find_endpoints(LinkID id, NodeID &ori, NodeID &des) const {
+		return false;
+	};
+
 	// Assignment function (assumes they are the same type, and
 	//	returns false if they are not.)
 	virtual bool copy(const Graph &gr) {
@@ -171,9 +221,16 @@ class Graph {
 		nedges=gr.get_edge_size();
 		loop=gr.if_loop();
 		multi_link=gr.if_multi_link();
+		this->notify_changed();
 		return true;
 	};
 
+	// Build this graph as a read-only copy of a given graph (only for frozen graphs
+	//	such as GraphFB_CSR; returns false for others).
+	virtual bool freeze(const Graph &gr) {
+		return false;
+	};
+
 	// Clearing all edges.
 	virtual void clear_edges()=0;
 
@@ -184,6 +241,11 @@ class Graph {
 	// (Returns false if it doesn't exist or unsuccessful).
 	virtual bool remove_edge(NodeID ori, NodeID des)=0; // For all graphs (remove all edges between two nodes).
 	virtual bool remove_edge_ID(NodeID ori, NodeID des, LinkID id)=0; //Remove the specified edge for graphs with ID (classes that ends with S).
+	virtual bool remove_edge_by_ID(LinkID id) { //Remove the edge with a given ID (classes that ends with S).
+		NodeID ori, des;
+		if (!this->find_endpoints(id,ori,des)) return false;
+		return this->remove_edge_ID(ori,des,id);
+	};
 
 	// Add a given edge. 
 	// Returns false if it fails (if it has a non-existing vertex, if the edge
@@ -208,6 +270,22 @@ class Graph {
 	virtual long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const=0;	//For classes that ends with S only.
 	virtual long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const=0;	//For classes that ends with S only.
 
+	// Visit the vertices connected to a given vertex without building a set
+	//	(same vertices as find_dep functions, in the sorted order).
+	// Returns the number of visits (-1 if the vertex doesn't belong to the graph).
+	// Visiting stops when visitor.visit returns false.
+	// (Default versions use find_dep functions; subclasses read their own data directly.)
+	virtual long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	virtual long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	virtual long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+
+	// Get the outward connected vertices of a given vertex as a range [first,last) of
+	//	an array (sorted, multilinks repeated), for graphs that store them contiguously.
+	// Returns false if the graph doesn't store them that way (or the vertex doesn't exist).
+	virtual bool access_out_deps(NodeID v, const NodeID *&first, const NodeID *&last) const {
+		return false;
+	};
+
 	// Find degree information.
 	// Find the number of degrees for a given vertex. 
 	// Returns -1 if the vertex doesn't exist.
@@ -250,10 +328,40 @@ class Graph {
 
 	// Find mean path length (distance) for all reachable pairs of nodes.
 	// (If there exist non-reachable pairs, use the second function.)
+	// Breadth-first searches from sampled sources are run 64 at a time (MultiBFS.h),
+	//	and divided among threads when compiled with OpenMP.
 	virtual double find_mean_distance(double percent_sample=100.0) const; // Assuming the whole network is one component.
 	virtual double find_mean_distance_component(const NodeIDSSet & component, \
 		double percent_sample=100.0) const; // Used when a cluster is known.
 
+	// Find the distribution of distances from sampled sources to all reachable vertices:
+	//	dist[d] is the number of pairs (source, vertex) with distance d (dist[0]: # of sources).
+	// Returns the largest distance found (the diameter of the graph when percent_sample=100,
+	//	a lower bound of it otherwise).
+	virtual long find_distance_distribution(std::vector<long> &dist, double percent_sample=100.0) const;
+
+	// Estimate statistics from random samples until the error is not larger than max_error
+	//	(or the maximum number of samples is reached).
+	// Mean distance: sources are sampled in groups of 64 (MultiBFS.h) up to max_percent %
+	//	of vertices (the error is 0 when all vertices are used, -1 when only one is used).
+	virtual Estimate estimate_mean_distance(double max_error, double max_percent=100.0) const;
+	// Clustering coefficient averaged over vertices (dir=0: all, 1: in, 2: out neighbors, as
+	//	in find_clustering_coeff): a random pair of neighbors of a random vertex is checked.
+	virtual Estimate estimate_clustering_coeff(double max_error, int dir=0, long max_samples=1000000) const;
+	// Global clustering coefficient (directions ignored, as in TriangleCounter): random pairs
+	//	of neighbors (wedges) are checked, each with the same probability.
+	virtual Estimate estimate_global_coeff(double max_error, long max_samples=1000000) const;
+
+	// Find distances from a given vertex to all reachable vertices (direction-optimizing
+	//	breadth-first search, DirectionBFS.h): dist is indexed by slots (-1 if not reachable),
+	//	and order has reachable vertices in the order of visits (the source first).
+	// Returns the largest distance (-1 if the vertex doesn't exist).
+	virtual long find_distances(NodeID source, std::vector<long> &dist, std::vector<NodeID> &order) const;
+
+	// Find the vertices within k steps from a given vertex (outward for digraphs; v not included).
+	// Returns the number of vertices found (-1 if the vertex doesn't exist).
+	virtual long find_k_hop(NodeID v, long k, NodeIDSSet &deps) const;
+
 	// Find the degree correlation coefficient.
 	virtual double find_degree_correlation(bool neighbor=false) const=0;
 
@@ -261,6 +369,33 @@ class Graph {
 	// (For directed graphs, find the number of weakly connected graphs.)
 	// (Returns the number of components.)
 	virtual long find_components(std::vector<NodeIDSSet> &components) const;
+
+	// Find the component of each vertex as labels indexed by slots (-1 for slots not used).
+	// Components are numbered from 0 in the order of their first slots (the same order as
+	//	find_components for graphs with fixed vertices).
+	// Array-based union-find (Afforest: two neighbors of each vertex are joined first, then
+	//	the rest, skipping the largest component), in parallel when compiled with OpenMP.
+	// (Returns the number of components.)
+	virtual long find_component_labels(std::vector<long> &labels) const;
+	// Same, using lists of all connected vertices already read (SlotLists(*this,false)).
+	long find_component_labels(const SlotLists &lists, std::vector<long> &labels) const;
+
+	// Find the components as sets from labels given by find_component_labels.
+	// (Returns the number of components.)
+	long find_components(const std::vector<long> &labels, std::vector<NodeIDSSet> &components) const;
+
+	// Find the strongly connected components as labels indexed by slots (-1 for slots not used),
+	//	using Pearce's algorithm without recursion (linear time, no sets).
+	// Components are numbered in the order they are finished (reverse topological order),
+	//	so edges between components go from larger labels to smaller ones.
+	// (Same as find_component_labels for bidirectional graphs, except the order of labels.)
+	// (Returns the number of components.)
+	virtual long find_strong_component_labels(std::vector<long> &labels) const;
+
+	// Find the edges of the condensation (the DAG of strongly connected components) from labels
+	//	given by find_strong_component_labels, as sorted pairs of labels (ori, des).
+	// (Returns the number of edges.)
+	long find_condensation(const std::vector<long> &labels, std::vector<std::pair<long,long> > &edges) const;
 	
 	// Print the graph showing all vertices and edges.
 	// 	print  : show vertices and edges separately.
@@ -282,11 +417,24 @@ class Graph {
 	virtual bool read2(std::istream &ifile)=0;
 
    protected:
+	// Tell the observer about changes (called by subclasses after changes).
+	void notify_added(NodeID ori, NodeID des) {
+		if (observer) observer->edge_added(ori,des);
+	};
+	void notify_removed(NodeID ori, NodeID des) {
+		if (observer) observer->edge_removed(ori,des);
+	};
+	void notify_changed() {
+		if (observer) observer->graph_changed();
+	};
+
    	long nedges; // Number of edges.
 	LinkType edge_type; // Type of edges (links).
 
    	bool loop;
 	bool multi_link;
+
+	GraphObserver *observer; // Observer of changes (0 if none).
 };
 
 
@@ -324,6 +472,14 @@ class GraphF: public Graph {
 		else return true;
 	};
 
+	// Get the number of slots and find the slot of a given vertex (slot=vertex).
+	long get_slot_size() const {
+		return nvertices;
+	};
+	long find_slot(NodeID v) const {
+		return this->find_vertex(v)? v : -1;
+	};
+
 	// Find the degree sequence (not sorted). (Returns the maximun degree value)
 	long find_degree_sequence(std::vector<long> &degree, bool neighbor=false) const;
 	long find_in_deg_sequence(std::vector<long> &degree, bool neighbor=false) const;
@@ -345,18 +501,26 @@ class GraphF: public Graph {
 };
 
 // Abstract class that represents graphs with varying vertices.
+// Vertices are indexed by a hash table (vindex) that gives each vertex a dense slot,
+//	and subclasses store the data for vertices in vectors using these slots.
+// The index is the only one used for lookups (find_vertex, get_vertex_size, slots and edges),
+//	so vertices should be added/removed by add_vertex/remove_vertex, and update_vertices() should
+//	be called after the set of vertices is changed from outside (changes are not seen before that).
 class GraphV : public Graph {
    public :
 	// Constructors.
    	GraphV(NodeIDSSet &vs, LinkType lt=0, bool l=false, bool m=false)	// there should be a set of vertices already
-		: Graph(lt,l,m), vertexset(vs) {};
+		: Graph(lt,l,m), vertexset(vs), vindex() {
+		for (NodeIDSSet::const_iterator i=vertexset.begin();i!=vertexset.end();i++)
+			vindex.add(*i);
+	};
 
 	// Destructor.
 	~GraphV() {};
 
 	// Get sizes of vertices.
 	long get_vertex_size() const {
-		return vertexset.size();
+		return vindex.size();
 	};
 
 	// Show if nodes are fixed.
@@ -366,11 +530,53 @@ class GraphV : public Graph {
 
 	// Find the set of all current vertices.
 	void find_vertices(NodeIDSSet &vs) const {
-		vs=vertexset;
+		vs.clear();
+		for (long slot=0;slot<vindex.get_slot_size();slot++)
+			if (vindex.get_ID(slot)>=0) vs.insert(vindex.get_ID(slot));
 	};
 	// Find if the given vertex exists.
 	bool find_vertex(NodeID v) const {
-		return (vertexset.find(v)!=vertexset.end());
+		return (vindex.find(v)>=0);
+	};
+
+	// Get the number of slots and find the slot of a given vertex (from vindex).
+	long get_slot_size() const {
+		return vindex.get_slot_size();
+	};
+	long find_slot(NodeID v) const {
+		return vindex.find(v);
+	};
+
+	// Add a vertex (returns false if it already exists).
+	virtual bool add_vertex(NodeID v) {
+		if (vindex.find(v)>=0) return false;
+		vertexset.insert(v);
+		vindex.add(v);
+		this->notify_changed();
+		return true;
+	};
+
+	// Remove a vertex (returns false if it doesn't exist).
+	// (Subclasses also remove the edges connected to the vertex.)
+	virtual bool remove_vertex(NodeID v) {
+		if (vindex.remove(v)<0) return false;
+		vertexset.erase(v);
+		this->notify_changed();
+		return true;
+	};
+
+	// Update the index after the set of vertices is changed from outside
+	//	(vertices not in the set are removed with their edges, and new ones are added).
+	void update_vertices() {
+		std::vector<NodeID> removed;
+		for (long slot=0;slot<vindex.get_slot_size();slot++) {
+			NodeID v=vindex.get_ID(slot);
+			if (v>=0 && vertexset.find(v)==vertexset.end()) removed.push_back(v);
+		};
+		for (unsigned long i=0;i<removed.size();i++)
+			this->remove_vertex(removed[i]);
+		for (NodeIDSSet::const_iterator i=vertexset.begin();i!=vertexset.end();i++)
+			if (vindex.find(*i)<0) this->add_vertex(*i);
 	};
 
 	// Find the degree sequence (not sorted). (Returns the maximun degree value)
@@ -391,6 +597,7 @@ class GraphV : public Graph {
 
    protected:
    	NodeIDSSet &vertexset; // Set of all vertices (reference).
+	VertexIndex vindex; // Index of vertices (NodeID -> slot).
 
 };
 
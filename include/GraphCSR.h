@@ -0,0 +1,353 @@
+//
+//	CONETSIM - GraphCSR.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+#ifndef GRAPHCSR_H
+#define GRAPHCSR_H
+
+#include "Graph.h"
+#include "Types.h"
+#include <vector>
+#include <istream>
+#include <ostream>
+
+namespace conet {
+
+// Frozen (read-only) graphs with fixed vertices stored in the compressed sparse row (CSR) format.
+// Neighbors of a vertex v are stored in one contiguous array (adj), sorted,
+//	from adj[offsets[v]] to adj[offsets[v+1]-1] (multilinks are stored as repeated values).
+// These graphs are built once from another graph with fixed vertices (freeze),
+//	and are meant for fixed link types (GraphsFixed) that do not change after initialization.
+// Adding/removing edges is not allowed (returns false), like GraphFB_Full.
+
+// Class for frozen graphs (fixed # of vertices, bidirectional links, no link state)
+class GraphFB_CSR : public GraphF {
+   public :
+	// Constructor.
+   	GraphFB_CSR(NodeID nv=0, LinkType lt=0, bool l=false, bool m=false) : GraphF(nv,lt,l,m), offsets(nv+1,0) {};
+	// Build from a given graph (should be a bidirectional graph with fixed vertices).
+   	GraphFB_CSR(const Graph &gr) : GraphF(0), offsets(1,0) {
+		this->freeze(gr);
+	};
+
+	// Reset the graph by setting the size of vertices (to be used to start from scratch).
+	// (delete all edges if exists)
+	void reset(long nv) {
+		nvertices=nv;
+		this->clear_edges();
+	};
+
+	// Virtual destructor.
+	~GraphFB_CSR() {};
+
+	// Build this graph from a given bidirectional graph with fixed vertices.
+	// Returns false if the given graph cannot be frozen into this class.
+	bool freeze(const Graph &gr);
+
+	// Show if links are directional.
+	bool if_directional() const {
+		return false;
+	};
+
+	// Show if links have states.
+	bool if_link_ID() const {
+		return false;
+	};
+
+	// Find the set of all current edges (only works when there are edge states, classes that ends with S).
+	bool find_all_edges(LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Find if an edge(s) exists between two nodes (binary search).
+	// Returns true if existi(s), false if there is no edge.
+	bool find_edge(NodeID ori, NodeID des);
+	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Assignment function.
+	bool copy(const Graph &gr);
+
+	// Clearing all edges only.
+	void clear_edges();
+
+	// Make this graph full.
+	void make_full();
+
+	// Remove or add edge(s) between ori and des (not allowed for frozen graphs).
+	bool remove_edge(NodeID ori, NodeID des) {
+		return false;
+	};
+	bool remove_edge_ID(NodeID ori, NodeID des, LinkID id) {
+		return false;
+	};
+	bool add_edge(NodeID ori, NodeID des) {
+		return false;
+	};
+	bool add_edge_ID(NodeID ori, NodeID des, LinkID e1) {
+		return false;
+	};
+
+	// Find the vertices that are connected to a given vertex. (Return the number
+	// 	of vertices or -1 if the vertex doesn't belong to the graph.)
+	// If neighbor=true, find the true neighbors (multilink and loop ignored).
+	long find_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_in_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const {
+		return this->find_dep(v,deps,neighbor);
+	};
+	long find_out_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const {
+		return this->find_dep(v,deps,neighbor);
+	};
+
+	long find_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_in_dep2(NodeID v, NodeIDSSet &deps) const {
+		return this->find_dep2(v,deps);
+	};
+	long find_out_dep2(NodeID v, NodeIDSSet &deps) const {
+		return this->find_dep2(v,deps);
+	};
+
+	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+
+	// Get the connected vertices as a range of adj.
+	bool access_out_deps(NodeID v, const NodeID *&first, const NodeID *&last) const {
+		if (!find_vertex(v)) return false;
+		first=adj.empty()? 0 : &adj[0]+offsets[v];
+		last=adj.empty()? 0 : &adj[0]+offsets[v+1];
+		return true;
+	};
+
+	// Find degree information.
+	// Find the number of degrees for a given vertex (O(1) when neighbor=false).
+	// Returns -1 if the vertex doesn't exist.
+	// If neighbor=true, find the number of neighbors (multilink and loop ignored).
+	long find_degree(NodeID v, bool neighbor=false) const;
+	long find_in_deg(NodeID v, bool neighbor=false) const {
+		return find_degree(v,neighbor);
+	};
+	long find_out_deg(NodeID v, bool neighbor=false) const {
+		return find_degree(v,neighbor);
+	};
+
+	// Find the number of edges between neighbors.
+	// Returns the number of edges and number of neighbors through argument.
+	long find_neighbor_connections(NodeID id, long &degree) const;
+	long find_in_neighbor_connections(NodeID id, long &degree) const {
+		return this->find_neighbor_connections(id,degree);
+	};
+	long find_out_neighbor_connections(NodeID id, long &degree) const {
+		return this->find_neighbor_connections(id,degree);
+	};
+
+	// Find other statistical quantities.
+	double find_degree_correlation(bool neighbor=false) const;
+
+	// Print the graph showing all vertices and edges (same formats as GraphFB).
+	void print() const;	// To stdout.
+	void write1(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write2(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write3(std::ostream &of) const;	// To a file.
+	void write_edges(std::ostream &of) const;	// To a file.
+	void write_degrees(std::ostream &of) const;	// To a file.
+
+	// Read the graph structure info from a file (same format as GraphFB::read1;
+	//	# of vertices are assumed to be known).
+	bool read1(std::istream &ifile);
+	bool read2(std::istream &ifile) {
+		return false;
+	};
+
+   protected:
+	// Check if des is in the sorted neighbor list of ori.
+	bool find_in_list(NodeID ori, NodeID des) const;
+
+	std::vector<long> offsets;	// Size: nvertices+1.
+	std::vector<NodeID> adj;	// Size: 2*nedges (minus the number of loops).
+};
+
+// Class for frozen graphs (fixed # of vertices, directional links, no link state)
+// Both inward (in_adj, like GraphFD::gra) and outward (out_adj, like GraphFD::gra_out)
+//	edges are stored.
+class GraphFD_CSR : public GraphF {
+   public :
+	// Constructor.
+   	GraphFD_CSR(NodeID nv=0, LinkType lt=0, bool l=false, bool m=false)
+		: GraphF(nv,lt,l,m), in_offsets(nv+1,0), out_offsets(nv+1,0) {};
+	// Build from a given graph (should be a directional graph with fixed vertices).
+   	GraphFD_CSR(const Graph &gr) : GraphF(0), in_offsets(1,0), out_offsets(1,0) {
+		this->freeze(gr);
+	};
+
+	// Reset the graph by setting the size of vertices (to be used to start from scratch).
+	// (delete all edges if exists)
+	void reset(long nv) {
+		nvertices=nv;
+		this->clear_edges();
+	};
+
+	// Virtual destructor.
+	~GraphFD_CSR() {};
+
+	// Build this graph from a given directional graph with fixed vertices.
+	// Returns false if the given graph cannot be frozen into this class.
+	bool freeze(const Graph &gr);
+
+	// Show if links are directional.
+	bool if_directional() const {
+		return true;
+	};
+
+	// Show if links have states.
+	bool if_link_ID() const {
+		return false;
+	};
+
+	// Find the set of all current edges (only works when there are edge states, classes that ends with S).
+	bool find_all_edges(LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Find if an edge(s) exists from ori to des (binary search).
+	// Returns true if existi(s), false if there is no edge.
+	bool find_edge(NodeID ori, NodeID des);
+	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Assignment function.
+	bool copy(const Graph &gr);
+
+	// Clearing all edges only.
+	void clear_edges();
+
+	// Make this graph full.
+	void make_full();
+
+	// Remove or add edge(s) between ori and des (not allowed for frozen graphs).
+	bool remove_edge(NodeID ori, NodeID des) {
+		return false;
+	};
+	bool remove_edge_ID(NodeID ori, NodeID des, LinkID id) {
+		return false;
+	};
+	bool add_edge(NodeID ori, NodeID des) {
+		return false;
+	};
+	bool add_edge_ID(NodeID ori, NodeID des, LinkID e1) {
+		return false;
+	};
+
+	// Find the vertices that are connected to a given vertex. (Return the number
+	// 	of vertices or -1 if the vertex doesn't belong to the graph.)
+	// If neighbor=true, find the true neighbors (multilink and loop ignored).
+	long find_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_in_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_out_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+
+	long find_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_in_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_out_dep2(NodeID v, NodeIDSSet &deps) const;
+
+	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+
+	// Get the outward connected vertices as a range of out_adj.
+	bool access_out_deps(NodeID v, const NodeID *&first, const NodeID *&last) const {
+		if (!find_vertex(v)) return false;
+		first=out_adj.empty()? 0 : &out_adj[0]+out_offsets[v];
+		last=out_adj.empty()? 0 : &out_adj[0]+out_offsets[v+1];
+		return true;
+	};
+
+	// Find degree information.
+	// Find the number of degrees for a given vertex (O(1) when neighbor=false).
+	// Returns -1 if the vertex doesn't exist.
+	// If neighbor=true, find the number of neighbors (multilink and loop ignored).
+	long find_degree(NodeID v, bool neighbor=false) const;
+	long find_in_deg(NodeID v, bool neighbor=false) const;
+	long find_out_deg(NodeID v, bool neighbor=false) const;
+
+	// Find the number of edges between neighbors.
+	// Returns the number of edges and number of neighbors through argument.
+	long find_neighbor_connections(NodeID id, long &degree) const;
+	long find_in_neighbor_connections(NodeID id, long &degree) const;
+	long find_out_neighbor_connections(NodeID id, long &degree) const;
+
+	// Find other statistical quantities.
+	double find_degree_correlation(bool neighbor=false) const;
+
+	// Print the graph showing all vertices and edges (same formats as GraphFD).
+	void print() const;	// To stdout.
+	void write1(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write2(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write3(std::ostream &of) const;	// To a file.
+	void write_edges(std::ostream &of) const;	// To a file.
+	void write_degrees(std::ostream &of) const;	// To a file.
+
+	// Read the graph structure info from a file (same format as GraphFD::read1).
+	bool read1(std::istream &ifile);
+	bool read2(std::istream &ifile) {
+		return false;
+	};
+
+   protected:
+	// Count the number of edges among the given (sorted, distinct) vertices.
+	long count_connections(const std::vector<NodeID> &deps) const;
+	// Find the sorted distinct neighbors (dir=0: both, 1: in, 2: out).
+	void find_neighbor_list(NodeID v, std::vector<NodeID> &deps, int dir) const;
+
+	std::vector<long> in_offsets;	// Size: nvertices+1.
+	std::vector<NodeID> in_adj;	// Inward edges (origins) for each vertex.
+	std::vector<long> out_offsets;	// Size: nvertices+1.
+	std::vector<NodeID> out_adj;	// Outward edges (destinations) for each vertex.
+};
+
+}; // End of namespace conet.
+#endif
@@ -0,0 +1,484 @@
+//
+//	CONETSIM - GraphCompressed.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+#ifndef GRAPHCOMPRESSED_H
+#define GRAPHCOMPRESSED_H
+
+#include "Graph.h"
+#include "Types.h"
+#include <vector>
+#include <istream>
+#include <ostream>
+
+namespace conet {
+
+// Iterator that decodes a sorted list of vertices stored as gaps in varint format
+//	(7 bits in each byte, and the highest bit shows that more bytes follow).
+// The first vertex is stored as it is, and others as differences from the previous vertex.
+class GapDecoder {
+   public :
+	// Constructor (decoding bytes from b to e).
+	GapDecoder(const unsigned char *b, const unsigned char *e) : pos(b), next(b), last(e), value(0) {
+		if (next!=last) value=this->decode();
+	};
+
+	NodeID operator*() const {
+		return value;
+	};
+
+	GapDecoder & operator++() {
+		pos=next;
+		if (next!=last) value+=this->decode();
+		return *this;
+	};
+
+	bool operator==(const GapDecoder &d) const {
+		return pos==d.pos;
+	};
+	bool operator!=(const GapDecoder &d) const {
+		return pos!=d.pos;
+	};
+
+   private:
+	// Decode a number starting from next.
+	long decode() {
+		unsigned long x=0;
+		int shift=0;
+		unsigned char c;
+		do {
+			c=*next++;
+			x|=(unsigned long)(c&0x7f)<<shift;
+			shift+=7;
+		} while (c&0x80);
+		return x;
+	};
+
+	const unsigned char *pos;	// Start of the current vertex.
+	const unsigned char *next;	// Start of the next vertex.
+	const unsigned char *last;	// End of the list.
+	NodeID value;			// Current vertex.
+};
+
+// Sorted lists of vertices (one for each vertex) stored in one array of bytes using GapDecoder's format.
+// Lists should be added in the order of vertices (0, 1, 2,...).
+class GapLists {
+   public :
+	// Constructor.
+	GapLists() : offsets(1,0), counts(), data() {};
+
+	// Remove all lists and make n empty lists (memory is released).
+	void reset(long n) {
+		offsets.assign(n+1,0);
+		counts.assign(n,0);
+		std::vector<unsigned char>().swap(data);
+	};
+
+	// Start adding lists from the beginning (nv lists will be added).
+	void start(long nv) {
+		offsets.clear();
+		offsets.reserve(nv+1);
+		offsets.push_back(0);
+		counts.clear();
+		counts.reserve(nv);
+		data.clear();
+	};
+
+	// Add the list for the next vertex (should be sorted).
+	void add(const std::vector<NodeID> &list);
+
+	// Release the memory not used (after adding all lists).
+	void shrink() {
+		std::vector<unsigned char>(data).swap(data);
+	};
+
+	// Iterators for the list of v.
+	GapDecoder begin(long v) const {
+		return GapDecoder(this->ptr(offsets[v]),this->ptr(offsets[v+1]));
+	};
+	GapDecoder end(long v) const {
+		return GapDecoder(this->ptr(offsets[v+1]),this->ptr(offsets[v+1]));
+	};
+
+	// Get the number of vertices in the list of v.
+	long size(long v) const {
+		return counts[v];
+	};
+
+	// Get the number of lists.
+	long get_nlists() const {
+		return counts.size();
+	};
+
+	// Get the total number of bytes used for lists.
+	long get_nbytes() const {
+		return data.size();
+	};
+
+	// Check if u is in the list of v.
+	bool find(long v, NodeID u) const;
+
+	// Decode the list of v into a vector.
+	void decode(long v, std::vector<NodeID> &list) const;
+
+	// Swap with other lists.
+	void swap(GapLists &other) {
+		offsets.swap(other.offsets);
+		counts.swap(other.counts);
+		data.swap(other.data);
+	};
+
+	// Save to (load from) a binary file.
+	void save(std::ostream &of) const;
+	bool load(std::istream &ifile);
+
+   private:
+	const unsigned char * ptr(long i) const {
+		return data.empty()? 0 : &data[0]+i;
+	};
+
+	std::vector<long> offsets;	// Start of each list in data (size: nlists+1).
+	std::vector<long> counts;	// Number of vertices in each list.
+	std::vector<unsigned char> data;	// Encoded lists.
+};
+
+// Frozen (read-only) graphs with fixed vertices where sorted neighbor lists are compressed
+//	(gaps between neighbors are stored in varint format, usually 1 or 2 bytes per edge).
+// They are for very large fixed graphs that don't fit in memory as other graphs;
+//	neighbors are decoded when used (for_each_dep functions don't need extra memory).
+// These graphs are built once from another graph with fixed vertices (freeze),
+//	by reading edges from a file (read1), or by loading a saved graph (load).
+// Adding/removing edges is not allowed (returns false), like GraphFB_CSR.
+
+// Class for frozen graphs (fixed # of vertices, bidirectional links, no link state)
+class GraphFB_Compressed : public GraphF {
+   public :
+	// Constructor.
+   	GraphFB_Compressed(NodeID nv=0, LinkType lt=0, bool l=false, bool m=false) : GraphF(nv,lt,l,m) {
+		adj.reset(nv);
+	};
+	// Build from a given graph (should be a bidirectional graph with fixed vertices).
+   	GraphFB_Compressed(const Graph &gr) : GraphF(0) {
+		this->freeze(gr);
+	};
+
+	// Reset the graph by setting the size of vertices (to be used to start from scratch).
+	// (delete all edges if exists)
+	void reset(long nv) {
+		nvertices=nv;
+		this->clear_edges();
+	};
+
+	// Virtual destructor.
+	~GraphFB_Compressed() {};
+
+	// Build this graph from a given bidirectional graph with fixed vertices.
+	// Returns false if the given graph cannot be frozen into this class.
+	bool freeze(const Graph &gr);
+
+	// Show if links are directional.
+	bool if_directional() const {
+		return false;
+	};
+
+	// Show if links have states.
+	bool if_link_ID() const {
+		return false;
+	};
+
+	// Find the set of all current edges (only works when there are edge states, classes that ends with S).
+	bool find_all_edges(LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Find if an edge(s) exists between two nodes (decoding the list of ori).
+	// Returns true if existi(s), false if there is no edge.
+	bool find_edge(NodeID ori, NodeID des);
+	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Assignment function.
+	bool copy(const Graph &gr);
+
+	// Clearing all edges only.
+	void clear_edges();
+
+	// Make this graph full.
+	void make_full();
+
+	// Remove or add edge(s) between ori and des (not allowed for frozen graphs).
+	bool remove_edge(NodeID ori, NodeID des) {
+		return false;
+	};
+	bool remove_edge_ID(NodeID ori, NodeID des, LinkID id) {
+		return false;
+	};
+	bool add_edge(NodeID ori, NodeID des) {
+		return false;
+	};
+	bool add_edge_ID(NodeID ori, NodeID des, LinkID e1) {
+		return false;
+	};
+
+	// Find the vertices that are connected to a given vertex. (Return the number
+	// 	of vertices or -1 if the vertex doesn't belong to the graph.)
+	// If neighbor=true, find the true neighbors (multilink and loop ignored).
+	long find_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_in_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const {
+		return this->find_dep(v,deps,neighbor);
+	};
+	long find_out_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const {
+		return this->find_dep(v,deps,neighbor);
+	};
+
+	long find_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_in_dep2(NodeID v, NodeIDSSet &deps) const {
+		return this->find_dep2(v,deps);
+	};
+	long find_out_dep2(NodeID v, NodeIDSSet &deps) const {
+		return this->find_dep2(v,deps);
+	};
+
+	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+
+	// Find degree information.
+	// Find the number of degrees for a given vertex (O(1) when neighbor=false).
+	// Returns -1 if the vertex doesn't exist.
+	// If neighbor=true, find the number of neighbors (multilink and loop ignored).
+	long find_degree(NodeID v, bool neighbor=false) const;
+	long find_in_deg(NodeID v, bool neighbor=false) const {
+		return find_degree(v,neighbor);
+	};
+	long find_out_deg(NodeID v, bool neighbor=false) const {
+		return find_degree(v,neighbor);
+	};
+
+	// Find the number of edges between neighbors.
+	// Returns the number of edges and number of neighbors through argument.
+	long find_neighbor_connections(NodeID id, long &degree) const;
+	long find_in_neighbor_connections(NodeID id, long &degree) const {
+		return this->find_neighbor_connections(id,degree);
+	};
+	long find_out_neighbor_connections(NodeID id, long &degree) const {
+		return this->find_neighbor_connections(id,degree);
+	};
+
+	// Find other statistical quantities.
+	double find_degree_correlation(bool neighbor=false) const;
+
+	// Print the graph showing all vertices and edges (same formats as GraphFB).
+	void print() const;	// To stdout.
+	void write1(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write2(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write3(std::ostream &of) const;	// To a file.
+	void write_edges(std::ostream &of) const;	// To a file.
+	void write_degrees(std::ostream &of) const;	// To a file.
+
+	// Read the graph structure info from a file (same format as GraphFB::read1;
+	//	# of vertices are assumed to be known).
+	bool read1(std::istream &ifile);
+	bool read2(std::istream &ifile) {
+		return false;
+	};
+
+	// Save (load) the compressed graph to (from) a binary file.
+	void save(std::ostream &of) const;
+	bool load(std::istream &ifile);
+
+	// Get the number of bytes used for edges.
+	long get_nbytes() const {
+		return adj.get_nbytes();
+	};
+
+   protected:
+	GapLists adj;	// Neighbors of each vertex (loops once).
+};
+
+// Class for frozen graphs (fixed # of vertices, directional links, no link state)
+// Both inward (in_adj, like GraphFD::gra) and outward (out_adj, like GraphFD::gra_out)
+//	edges are stored.
+class GraphFD_Compressed : public GraphF {
+   public :
+	// Constructor.
+   	GraphFD_Compressed(NodeID nv=0, LinkType lt=0, bool l=false, bool m=false)
+		: GraphF(nv,lt,l,m) {
+		in_adj.reset(nv);
+		out_adj.reset(nv);
+	};
+	// Build from a given graph (should be a directional graph with fixed vertices).
+   	GraphFD_Compressed(const Graph &gr) : GraphF(0) {
+		this->freeze(gr);
+	};
+
+	// Reset the graph by setting the size of vertices (to be used to start from scratch).
+	// (delete all edges if exists)
+	void reset(long nv) {
+		nvertices=nv;
+		this->clear_edges();
+	};
+
+	// Virtual destructor.
+	~GraphFD_Compressed() {};
+
+	// Build this graph from a given directional graph with fixed vertices.
+	// Returns false if the given graph cannot be frozen into this class.
+	bool freeze(const Graph &gr);
+
+	// Show if links are directional.
+	bool if_directional() const {
+		return true;
+	};
+
+	// Show if links have states.
+	bool if_link_ID() const {
+		return false;
+	};
+
+	// Find the set of all current edges (only works when there are edge states, classes that ends with S).
+	bool find_all_edges(LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Find if an edge(s) exists from ori to des (decoding the list of ori).
+	// Returns true if existi(s), false if there is no edge.
+	bool find_edge(NodeID ori, NodeID des);
+	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Assignment function.
+	bool copy(const Graph &gr);
+
+	// Clearing all edges only.
+	void clear_edges();
+
+	// Make this graph full.
+	void make_full();
+
+	// Remove or add edge(s) between ori and des (not allowed for frozen graphs).
+	bool remove_edge(NodeID ori, NodeID des) {
+		return false;
+	};
+	bool remove_edge_ID(NodeID ori, NodeID des, LinkID id) {
+		return false;
+	};
+	bool add_edge(NodeID ori, NodeID des) {
+		return false;
+	};
+	bool add_edge_ID(NodeID ori, NodeID des, LinkID e1) {
+		return false;
+	};
+
+	// Find the vertices that are connected to a given vertex. (Return the number
+	// 	of vertices or -1 if the vertex doesn't belong to the graph.)
+	// If neighbor=true, find the true neighbors (multilink and loop ignored).
+	long find_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_in_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_out_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+
+	long find_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_in_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_out_dep2(NodeID v, NodeIDSSet &deps) const;
+
+	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+
+	// Find degree information.
+	// Find the number of degrees for a given vertex (O(1) when neighbor=false).
+	// Returns -1 if the vertex doesn't exist.
+	// If neighbor=true, find the number of neighbors (multilink and loop ignored).
+	long find_degree(NodeID v, bool neighbor=false) const;
+	long find_in_deg(NodeID v, bool neighbor=false) const;
+	long find_out_deg(NodeID v, bool neighbor=false) const;
+
+	// Find the number of edges between neighbors.
+	// Returns the number of edges and number of neighbors through argument.
+	long find_neighbor_connections(NodeID id, long &degree) const;
+	long find_in_neighbor_connections(NodeID id, long &degree) const;
+	long find_out_neighbor_connections(NodeID id, long &degree) const;
+
+	// Find other statistical quantities.
+	double find_degree_correlation(bool neighbor=false) const;
+
+	// Print the graph showing all vertices and edges (same formats as GraphFD).
+	void print() const;	// To stdout.
+	void write1(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write2(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write3(std::ostream &of) const;	// To a file.
+	void write_edges(std::ostream &of) const;	// To a file.
+	void write_degrees(std::ostream &of) const;	// To a file.
+
+	// Read the graph structure info from a file (same format as GraphFD::read1).
+	bool read1(std::istream &ifile);
+	bool read2(std::istream &ifile) {
+		return false;
+	};
+
+	// Save (load) the compressed graph to (from) a binary file.
+	void save(std::ostream &of) const;
+	bool load(std::istream &ifile);
+
+	// Get the number of bytes used for edges.
+	long get_nbytes() const {
+		return in_adj.get_nbytes()+out_adj.get_nbytes();
+	};
+
+   protected:
+	// Count the number of edges among the given (sorted, distinct) vertices.
+	long count_connections(const std::vector<NodeID> &deps) const;
+	// Find the sorted distinct neighbors (dir=0: both, 1: in, 2: out).
+	void find_neighbor_list(NodeID v, std::vector<NodeID> &deps, int dir) const;
+
+	GapLists in_adj;	// Inward edges (origins) for each vertex.
+	GapLists out_adj;	// Outward edges (destinations) for each vertex.
+};
+
+}; // End of namespace conet.
+#endif
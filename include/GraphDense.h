@@ -0,0 +1,425 @@
+//
+//	CONETSIM - GraphDense.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+#ifndef GRAPHDENSE_H
+#define GRAPHDENSE_H
+
+#include "Graph.h"
+#include "Types.h"
+#include <vector>
+#include <istream>
+#include <ostream>
+
+namespace conet {
+
+// Square matrix of bits (n rows and n columns), each row stored in packed words.
+// Used by dense graphs (GraphFB_Dense, GraphFD_Dense).
+class BitMatrix {
+   public :
+	// Constructor.
+	BitMatrix(long n=0) : nrows(n), nwords(nwords_for(n)), data(n*nwords_for(n),0UL) {};
+
+	// Reset the size (all bits become 0).
+	void reset(long n) {
+		nrows=n;
+		nwords=nwords_for(n);
+		data.assign(n*nwords,0UL);
+	};
+
+	// Set all bits to 0.
+	void clear() {
+		data.assign(data.size(),0UL);
+	};
+
+	// Get the number of words in a row.
+	long get_nwords() const {
+		return nwords;
+	};
+
+	// Access a row.
+	const unsigned long * row(long i) const {
+		return &data[0]+i*nwords;
+	};
+
+	// Get, set, and reset a bit.
+	bool test(long i, long j) const {
+		return (data[i*nwords+j/WORD_BITS]>>(j%WORD_BITS))&1UL;
+	};
+	void set(long i, long j) {
+		data[i*nwords+j/WORD_BITS]|=1UL<<(j%WORD_BITS);
+	};
+	void reset(long i, long j) {
+		data[i*nwords+j/WORD_BITS]&=~(1UL<<(j%WORD_BITS));
+	};
+
+	// Count the number of bits in a row.
+	long count(long i) const {
+		const unsigned long *r=this->row(i);
+		long n=0;
+		for (long k=0;k<nwords;k++) n+=popcount(r[k]);
+		return n;
+	};
+
+	// Find the first bit not less than j in a row (returns the number of columns if none).
+	long next(long i, long j) const {
+		if (j>=nrows) return nrows;
+		long k=find_next(this->row(i),nwords,j);
+		return (k<nrows)? k : nrows;
+	};
+
+	// Find the first bit not less than j in an array of n words (returns n*WORD_BITS if none).
+	static long find_next(const unsigned long *r, long n, long j) {
+		long k=j/WORD_BITS;
+		if (k>=n) return n*WORD_BITS;
+		unsigned long w=r[k]&(~0UL<<(j%WORD_BITS));
+		while (!w) {
+			if (++k==n) return n*WORD_BITS;
+			w=r[k];
+		};
+		return k*WORD_BITS+lowest_bit(w);
+	};
+
+	// Number of bits in a word.
+	static const long WORD_BITS=8*sizeof(unsigned long);
+
+	// Count bits in a word.
+	static long popcount(unsigned long w) {
+#ifdef __GNUC__
+		return __builtin_popcountl(w);
+#else
+		long n=0;
+		for (;w;n++) w&=w-1;
+		return n;
+#endif
+	};
+
+	// Find the position of the lowest bit in a non-zero word.
+	static long lowest_bit(unsigned long w) {
+#ifdef __GNUC__
+		return __builtin_ctzl(w);
+#else
+		long n=0;
+		while (!(w&1UL)) {
+			w>>=1;
+			n++;
+		};
+		return n;
+#endif
+	};
+
+   private:
+	// Number of words for n bits.
+	static long nwords_for(long n) {
+		return (n+WORD_BITS-1)/WORD_BITS;
+	};
+
+	long nrows;	// Number of rows (and columns).
+	long nwords;	// Number of words in a row.
+	std::vector<unsigned long> data;	// Rows (nrows*nwords words).
+};
+
+// Graphs with fixed vertices where edges are stored as bits in an adjacency matrix.
+// Memory is O(N^2) bits regardless of the number of edges, so they are for small,
+//	dense networks: edge tests are O(1), degrees are found by counting bits, and
+//	edges between neighbors (clustering) are counted by AND operations of rows.
+// Multilinks are not allowed (multi_link is always false).
+
+// Class for graphs (fixed # of vertices, bidirectional links, no link state)
+class GraphFB_Dense : public GraphF {
+   public :
+	// Constructor.
+   	GraphFB_Dense() : GraphF(0) {};
+   	GraphFB_Dense(NodeID nv, LinkType lt=0, bool l=false, bool m=false) : GraphF(nv,lt,l,false), gra(nv) {};
+
+	// Reset the graph by setting the size of vertices (to be used to start from scratch).
+	// (delete all edges if exists)
+	void reset(long nv) {
+		gra.reset(nv);
+		nvertices=nv;
+		nedges=0;
+		this->notify_changed();
+	};
+
+	// Virtual destructor.
+	~GraphFB_Dense() {};
+
+	// Show if links are directional.
+	bool if_directional() const {
+		return false;
+	};
+
+	// Show if links have states.
+	bool if_link_ID() const {
+		return false;
+	};
+
+	// Find the set of all current edges (only works when there are edge states, classes that ends with S).
+	bool find_all_edges(LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Find if an edge exists between two nodes (ori: origin, des: destination).
+	// Returns true if exists, false if there is no edge.
+	bool find_edge(NodeID ori, NodeID des);
+	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Assignment function.
+	bool copy(const Graph &gr);
+
+	// Clearing all edges only.
+	void clear_edges();
+
+	// Make this graph full.
+	void make_full();
+
+	// Remove the edge between ori and des (Returns false if it doesn't exist).
+	bool remove_edge(NodeID ori, NodeID des);
+	bool remove_edge_ID(NodeID ori, NodeID des, LinkID id) {
+		return false;
+	};
+
+	// Add a given edge.
+	// Returns false if it fails (if it has a non-existing vertex, if the edge
+	// 	already exists, etc), true if successful.
+	bool add_edge(NodeID ori, NodeID des);
+	bool add_edge_ID(NodeID ori, NodeID des, LinkID e1) {
+		return false;
+	};
+
+	// Find the vertices that are connected to a given vertex. (Return the number
+	// 	of vertices or -1 if the vertex doesn't belong to the graph.)
+	// If neighbor=true, find the true neighbors (loop ignored).
+	long find_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_in_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const {
+		return this->find_dep(v,deps,neighbor);
+	};
+	long find_out_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const {
+		return this->find_dep(v,deps,neighbor);
+	};
+
+	long find_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_in_dep2(NodeID v, NodeIDSSet &deps) const {
+		return this->find_dep2(v,deps);
+	};
+	long find_out_dep2(NodeID v, NodeIDSSet &deps) const {
+		return this->find_dep2(v,deps);
+	};
+
+	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+
+	// Find degree information.
+	// Find the number of degrees for a given vertex (counting bits of a row).
+	// Returns -1 if the vertex doesn't exist.
+	// If neighbor=true, find the number of neighbors (loop ignored).
+	long find_degree(NodeID v, bool neighbor=false) const;
+	long find_in_deg(NodeID v, bool neighbor=false) const {
+		return find_degree(v,neighbor);
+	};
+	long find_out_deg(NodeID v, bool neighbor=false) const {
+		return find_degree(v,neighbor);
+	};
+
+	// Find the number of edges between neighbors (using AND operations of rows).
+	// Returns the number of edges and number of neighbors through argument.
+	long find_neighbor_connections(NodeID id, long &degree) const;
+	long find_in_neighbor_connections(NodeID id, long &degree) const {
+		return this->find_neighbor_connections(id,degree);
+	};
+	long find_out_neighbor_connections(NodeID id, long &degree) const {
+		return this->find_neighbor_connections(id,degree);
+	};
+
+	// Find other statistical quantities.
+	double find_degree_correlation(bool neighbor=false) const;
+
+	// Print the graph showing all vertices and edges (same formats as GraphFB).
+	void print() const;	// To stdout.
+	void write1(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write2(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write3(std::ostream &of) const;	// To a file.
+	void write_edges(std::ostream &of) const;	// To a file.
+	void write_degrees(std::ostream &of) const;	// To a file.
+
+	// Read the graph structure info from a file (same format as GraphFB::read1).
+	bool read1(std::istream &ifile);
+	bool read2(std::istream &ifile) {
+		return false;
+	};
+
+   protected:
+   	BitMatrix gra;	// gra.test(i,j) is true if i and j are connected.
+};
+
+// Class for graphs (fixed # of vertices, directional links, no link state)
+// Both inward (gra) and outward (gra_out) edges are stored as in GraphFD.
+class GraphFD_Dense : public GraphF {
+   public :
+	// Constructor.
+   	GraphFD_Dense() : GraphF(0) {};
+   	GraphFD_Dense(NodeID nv, LinkType lt=0, bool l=false, bool m=false)
+		: GraphF(nv,lt,l,false), gra(nv), gra_out(nv) {};
+
+	// Reset the graph by setting the size of vertices (to be used to start from scratch).
+	// (delete all edges if exists)
+	void reset(long nv) {
+		gra.reset(nv);
+		gra_out.reset(nv);
+		nvertices=nv;
+		nedges=0;
+		this->notify_changed();
+	};
+
+	// Virtual destructor.
+	~GraphFD_Dense() {};
+
+	// Show if links are directional.
+	bool if_directional() const {
+		return true;
+	};
+
+	// Show if links have states.
+	bool if_link_ID() const {
+		return false;
+	};
+
+	// Find the set of all current edges (only works when there are edge states, classes that ends with S).
+	bool find_all_edges(LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Find if an edge exists from ori to des.
+	// Returns true if exists, false if there is no edge.
+	bool find_edge(NodeID ori, NodeID des);
+	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Assignment function.
+	bool copy(const Graph &gr);
+
+	// Clearing all edges only.
+	void clear_edges();
+
+	// Make this graph full.
+	void make_full();
+
+	// Remove the edge from ori to des (Returns false if it doesn't exist).
+	bool remove_edge(NodeID ori, NodeID des);
+	bool remove_edge_ID(NodeID ori, NodeID des, LinkID id) {
+		return false;
+	};
+
+	// Add a given edge.
+	// Returns false if it fails (if it has a non-existing vertex, if the edge
+	// 	already exists, etc), true if successful.
+	bool add_edge(NodeID ori, NodeID des);
+	bool add_edge_ID(NodeID ori, NodeID des, LinkID e1) {
+		return false;
+	};
+
+	// Find the vertices that are connected to a given vertex. (Return the number
+	// 	of vertices or -1 if the vertex doesn't belong to the graph.)
+	// If neighbor=true, find the true neighbors (loop ignored).
+	long find_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_in_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_out_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+
+	long find_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_in_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_out_dep2(NodeID v, NodeIDSSet &deps) const;
+
+	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+
+	// Find degree information.
+	// Find the number of degrees for a given vertex (counting bits of rows).
+	// Returns -1 if the vertex doesn't exist.
+	// If neighbor=true, find the number of neighbors (loop ignored).
+	long find_degree(NodeID v, bool neighbor=false) const;
+	long find_in_deg(NodeID v, bool neighbor=false) const;
+	long find_out_deg(NodeID v, bool neighbor=false) const;
+
+	// Find the number of edges between neighbors (using AND operations of rows).
+	// Returns the number of edges and number of neighbors through argument.
+	long find_neighbor_connections(NodeID id, long &degree) const;
+	long find_in_neighbor_connections(NodeID id, long &degree) const;
+	long find_out_neighbor_connections(NodeID id, long &degree) const;
+
+	// Find other statistical quantities.
+	double find_degree_correlation(bool neighbor=false) const;
+
+	// Print the graph showing all vertices and edges (same formats as GraphFD).
+	void print() const;	// To stdout.
+	void write1(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write2(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write3(std::ostream &of) const;	// To a file.
+	void write_edges(std::ostream &of) const;	// To a file.
+	void write_degrees(std::ostream &of) const;	// To a file.
+
+	// Read the graph structure info from a file (same format as GraphFD::read1).
+	bool read1(std::istream &ifile);
+	bool read2(std::istream &ifile) {
+		return false;
+	};
+
+   protected:
+	// Find the neighbors as a row of bits (dir=0: both, 1: in, 2: out; loop ignored).
+	void find_neighbor_row(NodeID v, std::vector<unsigned long> &row, int dir) const;
+	// Count the number of edges among the vertices given as a row of bits (loops ignored).
+	long count_connections(const std::vector<unsigned long> &row) const;
+
+   	BitMatrix gra;		// Inward edges (gra.test(des,ori)).
+   	BitMatrix gra_out;	// Outward edges (gra_out.test(ori,des)).
+};
+
+}; // End of namespace conet.
+#endif
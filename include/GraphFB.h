@@ -23,6 +23,7 @@
 #define GRAPHFB_H
 
 #include "Graph.h"
+#include "DegreeCounts.h"
 #include "Types.h"
 #include <set>
 #include <map>
@@ -36,13 +37,14 @@ class GraphFB : public GraphF {
    public :
 	// Constructor.
    	GraphFB() : GraphF(0) {};
-   	GraphFB(NodeID nv, LinkType lt=0, bool l=false, bool m=false) : GraphF(nv,lt,l,m), gra(nv) {};
+   	GraphFB(NodeID nv, LinkType lt=0, bool l=false, bool m=false) : GraphF(nv,lt,l,m), gra(nv), degs(nv) {};
 
 	// Reset the graph by setting the size of vertices (to be used to start from scratch).
 	// (delete all edges if exists; for GraphV's, nodes will be created from 0 to nv-1)
 	void reset(long nv) {
 		this->clear_edges();
 		gra.resize(nv);
+		degs.resize(nv);
 		nvertices=nv;
 	};
 
@@ -126,8 +128,17 @@ class GraphFB : public GraphF {
 		return -1;
 	};
 
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+
 	// Find degree information.
-	// Find the number of degrees for a given vertex. 
+	// Find the number of degrees for a given vertex (O(1), degrees are kept updated).
 	// Returns -1 if the vertex doesn't exist.
 	// If neighbor=true, find the number of neighbors (multilink and loop ignored).
 	long find_degree(NodeID v, bool neighbor=false) const;
@@ -138,6 +149,15 @@ class GraphFB : public GraphF {
 		return find_degree(v,neighbor);
 	};
 
+	// Find the degree sequence (copied from the degree counters).
+	long find_degree_sequence(std::vector<long> &degree, bool neighbor=false) const;
+	long find_in_deg_sequence(std::vector<long> &degree, bool neighbor=false) const {
+		return this->find_degree_sequence(degree,neighbor);
+	};
+	long find_out_deg_sequence(std::vector<long> &degree, bool neighbor=false) const {
+		return this->find_degree_sequence(degree,neighbor);
+	};
+
 	// Find the number of edges between neighbors.
 	// Returns the number of edges and number of neighbors through argument.
 	long find_neighbor_connections(NodeID id, long &degree) const;
@@ -176,6 +196,7 @@ class GraphFB : public GraphF {
 
    protected:
    	std::vector<NodeIDMSet> gra;
+	DegreeCounts degs;	// Degrees of vertices.
 
 };
 
@@ -223,6 +244,9 @@ class GraphFB_Full: public GraphFB {
 	long find_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
 	long find_dep2(NodeID v, NodeIDSSet &deps) const;
 
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+
 	// Find degree information.
 	// Find the number of degrees for a given vertex. 
 	// Returns -1 if the vertex doesn't exist.
@@ -231,6 +255,9 @@ class GraphFB_Full: public GraphFB {
 		if (find_vertex(id)) return nvertices-1;
 		else return -1;
 	};
+	long find_degree_sequence(std::vector<long> &degree, bool neighbor=false) const {
+		return GraphF::find_degree_sequence(degree,neighbor);
+	};
 
 	// Find the number of edges between neighbors.
 	// Returns the number of edges and number of neighbors through argument.
@@ -242,6 +269,17 @@ class GraphFB_Full: public GraphFB {
 		else return -1;
 	};
 
+	// Find clustering coefficients (1 for all vertices).
+	double find_clustering_coeff() const {
+		return (nvertices>2)? 1.0 : 0.0;
+	};
+	double find_clustering_in_coeff() const {
+		return this->find_clustering_coeff();
+	};
+	double find_clustering_out_coeff() const {
+		return this->find_clustering_coeff();
+	};
+
 	// Find other statistical quantities.
 	double find_degree_correlation(bool neighbor=false) const {return 0.0;};
 
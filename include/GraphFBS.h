@@ -116,6 +116,18 @@ class GraphFBS : public GraphF {
 		return this->find_dep(v,deps,neighbor);
 	};
 
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		if (!find_vertex(v)) return -1;
+		return visit_deps(gra[v].begin(),gra[v].end(),v,visitor,neighbor);
+	};
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+
 	// Find degree information.
 	// Find the number of degrees for a given vertex. 
 	// Returns -1 if the vertex doesn't exist.
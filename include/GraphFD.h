@@ -23,6 +23,7 @@
 #define GRAPHFD_H
 
 #include "Graph.h"
+#include "DegreeCounts.h"
 #include "Types.h"
 #include <set>
 #include <map>
@@ -39,7 +40,8 @@ class GraphFD : public GraphF {
    public :
 	// Constructors.
    	GraphFD(): GraphF(0) {};
-	GraphFD(long nv, LinkType lt=0, bool l=false, bool m=false): GraphF(nv,lt,l,m), gra(nv), gra_out(nv) {};
+	GraphFD(long nv, LinkType lt=0, bool l=false, bool m=false): GraphF(nv,lt,l,m), gra(nv), gra_out(nv), \
+		degs(nv), in_degs(nv), out_degs(nv) {};
 
 	// Destructor.
 	~GraphFD() {};
@@ -50,6 +52,7 @@ class GraphFD : public GraphF {
 		this->clear_edges();
 		gra.resize(nv);
 		gra_out.resize(nv);
+		this->resize_degrees(nv);
 		nvertices=nv;
 	};
 
@@ -122,14 +125,23 @@ class GraphFD : public GraphF {
 		return -1;
 	};
 
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+
 	// Find degree information.
-	// Find the number of degrees for a given vertex. 
+	// Find the number of degrees for a given vertex (O(1), degrees are kept updated).
 	// Returns -1 if the vertex doesn't exist.
 	// If neighbor=true, find the number of neighbors (multilink and loop ignored).
 	long find_degree(NodeID v, bool neighbor=false) const;
 	long find_in_deg(NodeID v, bool neighbor=false) const;
 	long find_out_deg(NodeID v, bool neighbor=false) const;
-	
+
+	// Find the degree sequences (copied from the degree counters).
+	long find_degree_sequence(std::vector<long> &degree, bool neighbor=false) const;
+	long find_in_deg_sequence(std::vector<long> &degree, bool neighbor=false) const;
+	long find_out_deg_sequence(std::vector<long> &degree, bool neighbor=false) const;
 
 	// Find the number of edges between neighbors.
 	// Returns the number of edges and number of neighbors through argument.
@@ -162,11 +174,26 @@ class GraphFD : public GraphF {
 	};
 
    private :
+	// Update degrees after an edge from ori to des is added (or removed if add=false).
+	void count_edge(NodeID ori, NodeID des, bool add);
+
+	// Change the number of vertices for degrees.
+	void resize_degrees(long nv) {
+		degs.resize(nv);
+		in_degs.resize(nv);
+		out_degs.resize(nv);
+	};
+
    	// Information about in-edges and out-edges for each vertex. 
 	// By having both, we gain speed but lose some memory space.
 	std::vector<NodeIDMSet> gra;
 	std::vector<NodeIDMSet> gra_out;
 
+	// Degrees of vertices (all edges, in-edges, out-edges).
+	DegreeCounts degs;
+	DegreeCounts in_degs;
+	DegreeCounts out_degs;
+
 };
 
 }; // End of namespace conet.
@@ -23,6 +23,8 @@
 #define GRAPHFDS_H
 
 #include "Graph.h"
+#include "DegreeCounts.h"
+#include "EdgeIndex.h"
 #include "Types.h"
 #include "Errors.h"
 #include <set>
@@ -40,8 +42,9 @@ namespace conet {
 class GraphFDS : public GraphF {
    public :
 	// Constructors.
-   	GraphFDS(): GraphF(0) {};
-	GraphFDS(long nv, LinkType lt=0, bool l=false, bool m=false): GraphF(nv,lt,l,m), gra(nv), gra_out(nv) {};
+   	GraphFDS(): GraphF(0), if_index(false) {};
+	GraphFDS(long nv, LinkType lt=0, bool l=false, bool m=false): GraphF(nv,lt,l,m), gra(nv), gra_out(nv), \
+		if_index(false), degs(nv), in_degs(nv), out_degs(nv) {};
 	
 	// Destructor.
 	~GraphFDS() {};
@@ -52,6 +55,7 @@ class GraphFDS : public GraphF {
 		this->clear_edges();
 		gra.resize(nv);
 		gra_out.resize(nv);
+		this->resize_degrees(nv);
 		nvertices=nv;
 	};
 
@@ -73,6 +77,17 @@ class GraphFDS : public GraphF {
 	bool find_edge(NodeID ori, NodeID des);
 	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const; // only works when there are edge states, classes that ends with S.
 
+	// Use (or stop using) the table of end points for link IDs (links_info).
+	// With the table, find_endpoints and remove_edge_by_ID are O(1) (otherwise all edges are searched),
+	//	and add_edge_ID fails if the ID is already used.
+	void set_link_index(bool li);
+	bool if_link_index() const {
+		return if_index;
+	};
+
+	// Find the end points of an edge with a given ID (returns false if it doesn't exist).
+	bool find_endpoints(LinkID id, NodeID &ori, NodeID &des) const;
+
 	// Assignment function (should be careful copying pointers)
 	bool copy(const Graph &gr);
 
@@ -112,14 +127,23 @@ class GraphFDS : public GraphF {
 	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const;//For classes that ends with S only.
 	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const;//For classes that ends with S only.
 
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+
 	// Find degree information.
-	// Find the number of degrees for a given vertex. 
+	// Find the number of degrees for a given vertex (O(1), degrees are kept updated).
 	// Returns -1 if the vertex doesn't exist.
 	// If neighbor=true, find the number of neighbors (multilink and loop ignored).
 	long find_degree(NodeID v, bool neighbor=false) const;
 	long find_in_deg(NodeID v, bool neighbor=false) const;
 	long find_out_deg(NodeID v, bool neighbor=false) const;
-	
+
+	// Find the degree sequences (copied from the degree counters).
+	long find_degree_sequence(std::vector<long> &degree, bool neighbor=false) const;
+	long find_in_deg_sequence(std::vector<long> &degree, bool neighbor=false) const;
+	long find_out_deg_sequence(std::vector<long> &degree, bool neighbor=false) const;
 
 	// Find the number of edges between neighbors.
 	// Returns the number of edges and number of neighbors through argument.
@@ -152,13 +176,29 @@ class GraphFDS : public GraphF {
 	bool read2(std::istream &ifile);
 
    protected :
+	// Update degrees after an edge from ori to des is added (or removed if add=false).
+	void count_edge(NodeID ori, NodeID des, bool add);
+
+	// Change the number of vertices for degrees.
+	void resize_degrees(long nv) {
+		degs.resize(nv);
+		in_degs.resize(nv);
+		out_degs.resize(nv);
+	};
+
    	// Information about in-edges and out-edges for each vertex. 
 	// By having this information, we gain speed but lose some memory space.
 	std::vector<NodeIDLinkIDMMap> gra;
 	std::vector<NodeIDLinkIDMMap> gra_out;
 
-	// To get the information on ID.
-	// std::map<LinkID,pair<NodeID,NodeID> > links_info; // Not implemented this time to save the memory.
+	// To get the end points from ID (only when if_index=true, to save the memory otherwise).
+	bool if_index;
+	EdgeIndex links_info;
+
+	// Degrees of vertices (all edges, in-edges, out-edges).
+	DegreeCounts degs;
+	DegreeCounts in_degs;
+	DegreeCounts out_degs;
    	
 };
 
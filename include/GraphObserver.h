@@ -0,0 +1,51 @@
+//
+//	CONETSIM - GraphObserver.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef GRAPHOBSERVER_H
+#define GRAPHOBSERVER_H
+
+#include "Types.h"
+
+namespace conet {
+
+// Observer of changes of a graph (attached by Graph::set_observer), so that quantities
+//	computed from the graph (such as components, ComponentTracker.h) can be updated
+//	for each changed edge instead of being computed again from scratch.
+// Functions are called after the graph is changed.
+class GraphObserver {
+   public :
+	// Virtual destructor.
+	virtual ~GraphObserver() {};
+
+	// Called after an edge from ori to des is added.
+	virtual void edge_added(NodeID ori, NodeID des)=0;
+
+	// Called after an edge from ori to des is removed (other edges between them may remain).
+	virtual void edge_removed(NodeID ori, NodeID des)=0;
+
+	// Called when the graph is changed in other ways (edges cleared, copied or read,
+	//	vertices added or removed). The graph may not be ready to be read yet.
+	virtual void graph_changed()=0;
+};
+
+}; // End of namespace conet.
+#endif
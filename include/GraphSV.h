@@ -0,0 +1,362 @@
+//
+//	CONETSIM - GraphSV.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+#ifndef GRAPHSV_H
+#define GRAPHSV_H
+
+#include "Graph.h"
+#include "AdjList.h"
+#include "Types.h"
+#include <vector>
+#include <istream>
+#include <ostream>
+
+namespace conet {
+
+// Default number of neighbors above which a vertex uses a hash index.
+const long HUB_THRESHOLD=64;
+
+// Graphs with fixed vertices where each adjacency list is a sorted vector of
+//	(neighbor, multiplicity) pairs with inline storage for small degrees (AdjList).
+// They behave the same as GraphFB and GraphFD, but adding/removing edges mostly
+//	doesn't allocate memory, so they are better for graphs that are rewired often.
+// Vertices with many neighbors (hubs, common in scale-free graphs) switch automatically
+//	to lists with a hash index, so that finding, adding and removing their edges are O(1)
+//	(see set_hub_threshold; use sort_lists after changing edges to keep reading fast).
+
+// Class for graphs (fixed # of vertices, bidirectional links, no link state)
+class GraphFB_SV : public GraphF {
+   public :
+	// Constructor.
+   	GraphFB_SV() : GraphF(0), hub_threshold(HUB_THRESHOLD) {};
+   	GraphFB_SV(NodeID nv, LinkType lt=0, bool l=false, bool m=false)
+		: GraphF(nv,lt,l,m), gra(nv), hub_threshold(HUB_THRESHOLD) {};
+
+	// Reset the graph by setting the size of vertices (to be used to start from scratch).
+	// (delete all edges if exists)
+	void reset(long nv) {
+		gra.resize(nv);
+		nvertices=nv;
+		this->clear_edges(); // Observers are notified with the new vertices.
+	};
+
+	// Virtual destructor.
+	~GraphFB_SV() {};
+
+	// Set the number of neighbors above which a vertex uses a hash index for its edges
+	//	(0: never used); a vertex stops using it when it has less than a half of it.
+	void set_hub_threshold(long th);
+	long get_hub_threshold() const {
+		return hub_threshold;
+	};
+
+	// Sort the lists of hubs changed since the last call (they are not kept sorted while
+	//	edges are changed, and functions needing the order sort a copy of such a list).
+	void sort_lists();
+
+	// Show if links are directional.
+	bool if_directional() const {
+		return false;
+	};
+
+	// Show if links have states.
+	bool if_link_ID() const {
+		return false;
+	};
+
+	// Find the set of all current edges (only works when there are edge states, classes that ends with S).
+	bool find_all_edges(LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Find if an edge(s) exists between two nodes (ori: origin, des: destination).
+	// Returns true if existi(s), false if there is no edge.
+	bool find_edge(NodeID ori, NodeID des);
+	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Assignment function.
+	bool copy(const Graph &gr);
+
+	// Clearing all edges only.
+	void clear_edges();
+
+	// Make this graph full.
+	void make_full();
+
+	// Remove an edge between ori and des (Returns false if it doesn't exist).
+	bool remove_edge(NodeID ori, NodeID des);
+	bool remove_edge_ID(NodeID ori, NodeID des, LinkID id) {
+		return false;
+	};
+
+	// Add a given edge.
+	// Returns false if it fails (if it has a non-existing vertex, if the edge
+	// 	already exists (when multilink=false), etc), true if successful.
+	bool add_edge(NodeID ori, NodeID des);
+	bool add_edge_ID(NodeID ori, NodeID des, LinkID e1) {
+		return false;
+	};
+
+	// Find the vertices that are connected to a given vertex. (Return the number
+	// 	of vertices or -1 if the vertex doesn't belong to the graph.)
+	// If neighbor=true, find the true neighbors (multilink and loop ignored).
+	long find_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_in_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const {
+		return this->find_dep(v,deps,neighbor);
+	};
+	long find_out_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const {
+		return this->find_dep(v,deps,neighbor);
+	};
+
+	long find_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_in_dep2(NodeID v, NodeIDSSet &deps) const {
+		return this->find_dep2(v,deps);
+	};
+	long find_out_dep2(NodeID v, NodeIDSSet &deps) const {
+		return this->find_dep2(v,deps);
+	};
+
+	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+
+	// Find degree information.
+	// Find the number of degrees for a given vertex (O(1)).
+	// Returns -1 if the vertex doesn't exist.
+	// If neighbor=true, find the number of neighbors (multilink and loop ignored).
+	long find_degree(NodeID v, bool neighbor=false) const;
+	long find_in_deg(NodeID v, bool neighbor=false) const {
+		return find_degree(v,neighbor);
+	};
+	long find_out_deg(NodeID v, bool neighbor=false) const {
+		return find_degree(v,neighbor);
+	};
+
+	// Find the number of edges between neighbors.
+	// Returns the number of edges and number of neighbors through argument.
+	long find_neighbor_connections(NodeID id, long &degree) const;
+	long find_in_neighbor_connections(NodeID id, long &degree) const {
+		return this->find_neighbor_connections(id,degree);
+	};
+	long find_out_neighbor_connections(NodeID id, long &degree) const {
+		return this->find_neighbor_connections(id,degree);
+	};
+
+	// Find other statistical quantities.
+	double find_degree_correlation(bool neighbor=false) const;
+
+	// Print the graph showing all vertices and edges (same formats as GraphFB).
+	void print() const;	// To stdout.
+	void write1(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write2(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write3(std::ostream &of) const;	// To a file.
+	void write_edges(std::ostream &of) const;	// To a file.
+	void write_degrees(std::ostream &of) const;	// To a file.
+
+	// Read the graph structure info from a file (same format as GraphFB::read1).
+	bool read1(std::istream &ifile);
+	bool read2(std::istream &ifile) {
+		return false;
+	};
+
+   protected:
+	// Start (or stop) using the hash index for a list after it is changed.
+	void update_hub(AdjList &list) const {
+		if (hub_threshold<=0) return;
+		if (list.distinct()>hub_threshold) list.set_hub(true);
+		else if (2*list.distinct()<hub_threshold) list.set_hub(false);
+	};
+
+   	std::vector<AdjList> gra;
+	long hub_threshold;
+};
+
+// Class for graphs (fixed # of vertices, directional links, no link state)
+// Both inward (gra) and outward (gra_out) edges are stored as in GraphFD.
+class GraphFD_SV : public GraphF {
+   public :
+	// Constructor.
+   	GraphFD_SV() : GraphF(0), hub_threshold(HUB_THRESHOLD) {};
+   	GraphFD_SV(NodeID nv, LinkType lt=0, bool l=false, bool m=false)
+		: GraphF(nv,lt,l,m), gra(nv), gra_out(nv), hub_threshold(HUB_THRESHOLD) {};
+
+	// Reset the graph by setting the size of vertices (to be used to start from scratch).
+	// (delete all edges if exists)
+	void reset(long nv) {
+		gra.resize(nv);
+		gra_out.resize(nv);
+		nvertices=nv;
+		this->clear_edges(); // Observers are notified with the new vertices.
+	};
+
+	// Virtual destructor.
+	~GraphFD_SV() {};
+
+	// Set the number of neighbors above which a vertex uses a hash index for its edges
+	//	(0: never used); a vertex stops using it when it has less than a half of it.
+	void set_hub_threshold(long th);
+	long get_hub_threshold() const {
+		return hub_threshold;
+	};
+
+	// Sort the lists of hubs changed since the last call (they are not kept sorted while
+	//	edges are changed, and functions needing the order sort a copy of such a list).
+	void sort_lists();
+
+	// Show if links are directional.
+	bool if_directional() const {
+		return true;
+	};
+
+	// Show if links have states.
+	bool if_link_ID() const {
+		return false;
+	};
+
+	// Find the set of all current edges (only works when there are edge states, classes that ends with S).
+	bool find_all_edges(LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Find if an edge(s) exists from ori to des.
+	// Returns true if existi(s), false if there is no edge.
+	bool find_edge(NodeID ori, NodeID des);
+	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const {
+		return false;
+	};
+
+	// Assignment function.
+	bool copy(const Graph &gr);
+
+	// Clearing all edges only.
+	void clear_edges();
+
+	// Make this graph full.
+	void make_full();
+
+	// Remove an edge from ori to des (Returns false if it doesn't exist).
+	bool remove_edge(NodeID ori, NodeID des);
+	bool remove_edge_ID(NodeID ori, NodeID des, LinkID id) {
+		return false;
+	};
+
+	// Add a given edge.
+	// Returns false if it fails (if it has a non-existing vertex, if the edge
+	// 	already exists (when multilink=false), etc), true if successful.
+	bool add_edge(NodeID ori, NodeID des);
+	bool add_edge_ID(NodeID ori, NodeID des, LinkID e1) {
+		return false;
+	};
+
+	// Find the vertices that are connected to a given vertex. (Return the number
+	// 	of vertices or -1 if the vertex doesn't belong to the graph.)
+	// If neighbor=true, find the true neighbors (multilink and loop ignored).
+	long find_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_in_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+	long find_out_dep(NodeID v, NodeIDMSet &deps, bool neighbor=false) const;
+
+	long find_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_in_dep2(NodeID v, NodeIDSSet &deps) const;
+	long find_out_dep2(NodeID v, NodeIDSSet &deps) const;
+
+	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {
+		return -1;
+	};
+
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const;
+
+	// Find degree information.
+	// Find the number of degrees for a given vertex (O(1) except find_degree with neighbor=true).
+	// Returns -1 if the vertex doesn't exist.
+	// If neighbor=true, find the number of neighbors (multilink and loop ignored).
+	long find_degree(NodeID v, bool neighbor=false) const;
+	long find_in_deg(NodeID v, bool neighbor=false) const;
+	long find_out_deg(NodeID v, bool neighbor=false) const;
+
+	// Find the number of edges between neighbors.
+	// Returns the number of edges and number of neighbors through argument.
+	long find_neighbor_connections(NodeID id, long &degree) const;
+	long find_in_neighbor_connections(NodeID id, long &degree) const;
+	long find_out_neighbor_connections(NodeID id, long &degree) const;
+
+	// Find other statistical quantities.
+	double find_degree_correlation(bool neighbor=false) const;
+
+	// Print the graph showing all vertices and edges (same formats as GraphFD).
+	void print() const;	// To stdout.
+	void write1(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write2(std::ostream &of, long time=-1) const;	// To a file (when time<0, time will not be written)
+	void write3(std::ostream &of) const;	// To a file.
+	void write_edges(std::ostream &of) const;	// To a file.
+	void write_degrees(std::ostream &of) const;	// To a file.
+
+	// Read the graph structure info from a file (same format as GraphFD::read1).
+	bool read1(std::istream &ifile);
+	bool read2(std::istream &ifile) {
+		return false;
+	};
+
+   protected:
+	// Find the sorted distinct neighbors (dir=0: both, 1: in, 2: out).
+	void find_neighbor_list(NodeID v, std::vector<NodeID> &deps, int dir) const;
+	// Count the number of edges among the given (sorted, distinct) vertices.
+	long count_connections(const std::vector<NodeID> &deps) const;
+
+	// Start (or stop) using the hash index for a list after it is changed.
+	void update_hub(AdjList &list) const {
+		if (hub_threshold<=0) return;
+		if (list.distinct()>hub_threshold) list.set_hub(true);
+		else if (2*list.distinct()<hub_threshold) list.set_hub(false);
+	};
+
+   	std::vector<AdjList> gra;	// Inward edges.
+   	std::vector<AdjList> gra_out;	// Outward edges.
+	long hub_threshold;
+};
+
+}; // End of namespace conet.
+#endif
@@ -36,7 +36,7 @@ namespace conet {
 class GraphVB : public GraphV {
    public :
 	// Constructor.
-	GraphVB(NodeIDSSet &vs, LinkType lt=0, bool l=false, bool m=false): GraphV(vs,lt,l,m), gra() {};
+	GraphVB(NodeIDSSet &vs, LinkType lt=0, bool l=false, bool m=false): GraphV(vs,lt,l,m), gra(vindex.get_slot_size()) {};
 
 	// Virtual destructor.
 	~GraphVB() {};
@@ -45,9 +45,30 @@ class GraphVB : public GraphV {
 	// (delete all edges if exists; for GraphV's, nodes will be created from 0 to nv-1)
 	void reset(long nv) {
 		this->clear_edges();
+		vertexset.clear();
+		vindex.clear();
 		gra.clear();
 		for (NodeID id=0;id<nv;id++)
-			gra[id]=NodeIDMSet();
+			this->add_vertex(id);
+	};
+
+	// Add a vertex (returns false if it already exists).
+	bool add_vertex(NodeID v) {
+		if (!GraphV::add_vertex(v)) return false;
+		long slot=vindex.find(v);
+		if (slot>=long(gra.size())) gra.resize(slot+1);
+		return true;
+	};
+
+	// Remove a vertex with its edges (returns false if it doesn't exist).
+	bool remove_vertex(NodeID v) {
+		long slot=vindex.find(v);
+		if (slot<0) return false;
+		for (NodeIDMSet::const_iterator i=gra[slot].begin();i!=gra[slot].end();i++)
+			if (*i!=v) gra[vindex.find(*i)].erase(v);
+		nedges-=gra[slot].size();
+		gra[slot].clear();
+		return GraphV::remove_vertex(v);
 	};
 
 	// Show if links are directional.
@@ -126,6 +147,19 @@ class GraphVB : public GraphV {
 		return -1;
 	};
 
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		long slot=vindex.find(v);
+		if (slot<0) return -1;
+		return visit_deps(gra[slot].begin(),gra[slot].end(),v,visitor,neighbor);
+	};
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+
 	// Find degree information.
 	// Find the number of degrees for a given vertex. 
 	// Returns -1 if the vertex doesn't exist.
@@ -173,7 +207,7 @@ class GraphVB : public GraphV {
 	};
 
    protected:
-	std::map<NodeID,NodeIDMSet> gra;
+	std::vector<NodeIDMSet> gra; // Edges for each slot (see GraphV::vindex).
 
 };
    	
@@ -23,6 +23,7 @@
 #define GRAPHVBS_H
 
 #include "Graph.h"
+#include "EdgeIndex.h"
 #include "Types.h"
 #include <set>
 #include <map>
@@ -32,10 +33,11 @@
 namespace conet {
 
 // Class for graphs (varying # of vertices, bidirectional edges, with edge states).
-class GraphVBS : GraphV {
+class GraphVBS : public GraphV {
    public :
 	// Constructor.
-	GraphVBS(NodeIDSSet &vs, LinkType lt=0, bool l=false, bool m=false): GraphV(vs,lt,l,m), gra() {};
+	GraphVBS(NodeIDSSet &vs, LinkType lt=0, bool l=false, bool m=false)
+		: GraphV(vs,lt,l,m), gra(vindex.get_slot_size()), if_index(false) {};
 
 	// Virtual destructor.
 	~GraphVBS() {};
@@ -44,9 +46,32 @@ class GraphVBS : GraphV {
 	// (delete all edges if exists; for GraphV's, nodes will be created from 0 to nv-1)
 	void reset(long nv) {
 		this->clear_edges();
+		vertexset.clear();
+		vindex.clear();
 		gra.clear();
 		for (NodeID id=0;id<nv;id++)
-			gra[id]=NodeIDLinkIDMMap();
+			this->add_vertex(id);
+	};
+
+	// Add a vertex (returns false if it already exists).
+	bool add_vertex(NodeID v) {
+		if (!GraphV::add_vertex(v)) return false;
+		long slot=vindex.find(v);
+		if (slot>=long(gra.size())) gra.resize(slot+1);
+		return true;
+	};
+
+	// Remove a vertex with its edges (returns false if it doesn't exist).
+	bool remove_vertex(NodeID v) {
+		long slot=vindex.find(v);
+		if (slot<0) return false;
+		for (NodeIDLinkIDMMap::const_iterator i=gra[slot].begin();i!=gra[slot].end();i++) {
+			if (i->first!=v) gra[vindex.find(i->first)].erase(v);
+			if (if_index) links_info.erase(i->second);
+		};
+		nedges-=gra[slot].size();
+		gra[slot].clear();
+		return GraphV::remove_vertex(v);
 	};
 
 	// Show if links are directional.
@@ -67,6 +92,34 @@ class GraphVBS : GraphV {
 	bool find_edge(NodeID ori, NodeID des);
 	bool find_edge_ID(NodeID ori, NodeID des, LinkIDSet &edgeset) const; // only works when there are edge states, classes that ends with S.
 
+	// Use (or stop using) the table of end points for link IDs (links_info).
+	// With the table, find_endpoints and remove_edge_by_ID are O(1) (otherwise all edges are searched).
+	// (Functions changing edges should keep links_info when if_index=true.)
+	void set_link_index(bool li) {
+		if_index=li;
+		links_info.clear();
+		if (if_index)
+			for (long slot=0;slot<long(gra.size());slot++)
+				for (NodeIDLinkIDMMap::const_iterator i=gra[slot].begin();i!=gra[slot].end();i++)
+					links_info.insert(i->second,i->first,vindex.get_ID(slot));
+	};
+	bool if_link_index() const {
+		return if_index;
+	};
+
+	// Find the end points of an edge with a given ID (returns false if it doesn't exist).
+	bool find_endpoints(LinkID id, NodeID &ori, NodeID &des) const {
+		if (if_index) return links_info.find(id,ori,des);
+		for (long slot=0;slot<long(gra.size());slot++)
+			for (NodeIDLinkIDMMap::const_iterator i=gra[slot].begin();i!=gra[slot].end();i++)
+				if (i->second==id) {
+					ori=i->first;
+					des=vindex.get_ID(slot);
+					return true;
+				};
+		return false;
+	};
+
 	// Assignment function.
 	bool copy(const Graph &gr);
 
@@ -85,7 +138,9 @@ class GraphVBS : GraphV {
 	// Returns false if it fails (if it has a non-existing vertex, if the edge
 	// 	already exists (when multilink=false), etc), true if successful.
 	// When adding an edge with edge states, the default value will be given.
-	bool add_edge(NodeID ori, NodeID des); // For graphs without edge states
+	bool add_edge(NodeID ori, NodeID des) { // For graphs without edge states
+		return false;
+	};
 	bool add_edge_ID(NodeID ori, NodeID des, LinkID e1); // For graphs with edge states
 
 	// Find the vertices that are connected to a given vertex. (Return the number
@@ -102,18 +157,31 @@ class GraphVBS : GraphV {
 
 	long find_dep2(NodeID v, NodeIDSSet &deps) const;
 	long find_in_dep2(NodeID v, NodeIDSSet &deps) const {
-		return this->find_dep(v,deps);
+		return this->find_dep2(v,deps);
 	};
 	long find_out_dep2(NodeID v, NodeIDSSet &deps) const {
-		return this->find_dep(v,deps);
+		return this->find_dep2(v,deps);
 	};
 
-	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps, bool neighbor=false) const;	//For classes that ends with S only.
-	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps, bool neighbor=false) const {	//For classes that ends with S only.
-		return this->find_dep(v,deps,neighbor);
+	long find_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const;	//For classes that ends with S only.
+	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {	//For classes that ends with S only.
+		return this->find_dep_ID(v,deps);
 	};
-	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps, bool neighbor=false) const {//For classes that ends with S only.
-		return this->find_dep(v,deps,neighbor);
+	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const {//For classes that ends with S only.
+		return this->find_dep_ID(v,deps);
+	};
+
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		long slot=vindex.find(v);
+		if (slot<0) return -1;
+		return visit_deps(gra[slot].begin(),gra[slot].end(),v,visitor,neighbor);
+	};
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		return this->for_each_dep(v,visitor,neighbor);
 	};
 
 	// Find degree information.
@@ -163,7 +231,11 @@ class GraphVBS : GraphV {
 	bool read2(std::istream &ifile);
 
    protected:
-	std::map<NodeID,NodeIDLinkIDMMap> gra;
+	std::vector<NodeIDLinkIDMMap> gra; // Edges for each slot (see GraphV::vindex).
+
+	// To get the end points from ID (only when if_index=true).
+	bool if_index;
+	EdgeIndex links_info;
 
 };
    	
@@ -38,7 +38,8 @@ namespace conet {
 class GraphVD : public GraphV {
    public :
 	// Constructors.
-	GraphVD(NodeIDSSet &vs, LinkType lt=0, bool l=false, bool m=false): GraphV(vs,lt,l,m), gra(), gra_out() {};
+	GraphVD(NodeIDSSet &vs, LinkType lt=0, bool l=false, bool m=false)
+		: GraphV(vs,lt,l,m), gra(vindex.get_slot_size()), gra_out(vindex.get_slot_size()) {};
 
 	// Destructor.
 	~GraphVD() {};
@@ -47,12 +48,37 @@ class GraphVD : public GraphV {
 	// (delete all edges if exists; for GraphV's, nodes will be created from 0 to nv-1)
 	void reset(long nv) {
 		this->clear_edges();
+		vertexset.clear();
+		vindex.clear();
 		gra.clear();
 		gra_out.clear();
-		for (NodeID id=0;id<nv;id++) {
-			gra[id]=NodeIDMSet();
-			gra_out[id]=NodeIDMSet();
+		for (NodeID id=0;id<nv;id++)
+			this->add_vertex(id);
+	};
+
+	// Add a vertex (returns false if it already exists).
+	bool add_vertex(NodeID v) {
+		if (!GraphV::add_vertex(v)) return false;
+		long slot=vindex.find(v);
+		if (slot>=long(gra.size())) {
+			gra.resize(slot+1);
+			gra_out.resize(slot+1);
 		};
+		return true;
+	};
+
+	// Remove a vertex with its edges (returns false if it doesn't exist).
+	bool remove_vertex(NodeID v) {
+		long slot=vindex.find(v);
+		if (slot<0) return false;
+		for (NodeIDMSet::const_iterator i=gra[slot].begin();i!=gra[slot].end();i++)
+			if (*i!=v) gra_out[vindex.find(*i)].erase(v);
+		for (NodeIDMSet::const_iterator i=gra_out[slot].begin();i!=gra_out[slot].end();i++)
+			if (*i!=v) gra[vindex.find(*i)].erase(v);
+		nedges-=gra[slot].size()+gra_out[slot].size()-gra[slot].count(v); // Loops are counted once.
+		gra[slot].clear();
+		gra_out[slot].clear();
+		return GraphV::remove_vertex(v);
 	};
 
 	// Show if links are directional.
@@ -122,6 +148,24 @@ class GraphVD : public GraphV {
 		return -1;
 	};
 
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		long slot=vindex.find(v);
+		if (slot<0) return -1;
+		return visit_deps(gra[slot].begin(),gra[slot].end(),gra_out[slot].begin(),gra_out[slot].end(),\
+			v,visitor,neighbor);
+	};
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		long slot=vindex.find(v);
+		if (slot<0) return -1;
+		return visit_deps(gra[slot].begin(),gra[slot].end(),v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		long slot=vindex.find(v);
+		if (slot<0) return -1;
+		return visit_deps(gra_out[slot].begin(),gra_out[slot].end(),v,visitor,neighbor);
+	};
+
 	// Find degree information.
 	// Find the number of degrees for a given vertex. 
 	// Returns -1 if the vertex doesn't exist.
@@ -164,8 +208,9 @@ class GraphVD : public GraphV {
    private :
    	// Information about in-edges and out-edges for each vertex. 
 	// By having both, we gain speed but lose some memory space.
-	std::map<NodeID,NodeIDMSet> gra;
-	std::map<NodeID,NodeIDMSet> gra_out;
+	// (Stored for each slot, see GraphV::vindex.)
+	std::vector<NodeIDMSet> gra;
+	std::vector<NodeIDMSet> gra_out;
 
 };
 
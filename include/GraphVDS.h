@@ -23,6 +23,7 @@
 #define GRAPHVDS_H
 
 #include "Graph.h"
+#include "EdgeIndex.h"
 #include "Types.h"
 #include <set>
 #include <map>
@@ -37,7 +38,8 @@ namespace conet {
 class GraphVDS : public GraphV {
    public :
 	// Constructors.
-	GraphVDS(NodeIDSSet &vs, LinkType lt=0, bool l=false, bool m=false): GraphV(vs,lt,l,m), gra(), gra_out() {};
+	GraphVDS(NodeIDSSet &vs, LinkType lt=0, bool l=false, bool m=false)
+		: GraphV(vs,lt,l,m), gra(vindex.get_slot_size()), gra_out(vindex.get_slot_size()), if_index(false) {};
 
 	// Destructor.
 	~GraphVDS();
@@ -46,12 +48,41 @@ class GraphVDS : public GraphV {
 	// (delete all edges if exists; for GraphV's, nodes will be created from 0 to nv-1)
 	void reset(long nv) {
 		this->clear_edges();
+		vertexset.clear();
+		vindex.clear();
 		gra.clear();
 		gra_out.clear();
-		for (NodeID id=0;id<nv;id++) {
-			gra[id]=NodeIDLinkIDMMap();
-			gra_out[id]=NodeIDLinkIDMMap();
+		for (NodeID id=0;id<nv;id++)
+			this->add_vertex(id);
+	};
+
+	// Add a vertex (returns false if it already exists).
+	bool add_vertex(NodeID v) {
+		if (!GraphV::add_vertex(v)) return false;
+		long slot=vindex.find(v);
+		if (slot>=long(gra.size())) {
+			gra.resize(slot+1);
+			gra_out.resize(slot+1);
 		};
+		return true;
+	};
+
+	// Remove a vertex with its edges (returns false if it doesn't exist).
+	bool remove_vertex(NodeID v) {
+		long slot=vindex.find(v);
+		if (slot<0) return false;
+		for (NodeIDLinkIDMMap::const_iterator i=gra[slot].begin();i!=gra[slot].end();i++) {
+			if (i->first!=v) gra_out[vindex.find(i->first)].erase(v);
+			if (if_index) links_info.erase(i->second);
+		};
+		for (NodeIDLinkIDMMap::const_iterator i=gra_out[slot].begin();i!=gra_out[slot].end();i++) {
+			if (i->first!=v) gra[vindex.find(i->first)].erase(v);
+			if (if_index) links_info.erase(i->second);
+		};
+		nedges-=gra[slot].size()+gra_out[slot].size()-gra[slot].count(v); // Loops are counted once.
+		gra[slot].clear();
+		gra_out[slot].clear();
+		return GraphV::remove_vertex(v);
 	};
 
 	// Show if links are directional.
@@ -72,6 +103,34 @@ class GraphVDS : public GraphV {
 	bool find_edge(NodeID v1, NodeID des);
 	bool find_edge_ID(NodeID v1, NodeID des, LinkIDSet &edgeset) const; // only works when there are edge states, classes that ends with S.
 
+	// Use (or stop using) the table of end points for link IDs (links_info).
+	// With the table, find_endpoints and remove_edge_by_ID are O(1) (otherwise all edges are searched).
+	// (Functions changing edges should keep links_info when if_index=true.)
+	void set_link_index(bool li) {
+		if_index=li;
+		links_info.clear();
+		if (if_index)
+			for (long slot=0;slot<long(gra.size());slot++)
+				for (NodeIDLinkIDMMap::const_iterator i=gra[slot].begin();i!=gra[slot].end();i++)
+					links_info.insert(i->second,i->first,vindex.get_ID(slot));
+	};
+	bool if_link_index() const {
+		return if_index;
+	};
+
+	// Find the end points of an edge with a given ID (returns false if it doesn't exist).
+	bool find_endpoints(LinkID id, NodeID &ori, NodeID &des) const {
+		if (if_index) return links_info.find(id,ori,des);
+		for (long slot=0;slot<long(gra.size());slot++)
+			for (NodeIDLinkIDMMap::const_iterator i=gra[slot].begin();i!=gra[slot].end();i++)
+				if (i->second==id) {
+					ori=i->first;
+					des=vindex.get_ID(slot);
+					return true;
+				};
+		return false;
+	};
+
 	// Assignment function. (should be careful copying pointers)
 	bool copy(const Graph &gr);
 
@@ -90,7 +149,9 @@ class GraphVDS : public GraphV {
 	// Returns false if it fails (if it has a non-existing vertex, if the edge
 	// 	already exists (when multilink=false), etc), true if successful.
 	// When adding an edge with edge states, the default value will be given.
-	bool add_edge(NodeID v1, NodeID des); // For graphs without edge states
+	bool add_edge(NodeID v1, NodeID des) { // For graphs without edge states
+		return false;
+	};
 	bool add_edge_ID(NodeID v1, NodeID des, LinkID e1); // For graphs with edge states
 
 	// Find the vertices that are connected to a given vertex. (Return the number
@@ -109,6 +170,24 @@ class GraphVDS : public GraphV {
 	long find_in_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const;//For classes that ends with S only.
 	long find_out_dep_ID(NodeID v, NodeIDLinkIDMMap &deps) const;//For classes that ends with S only.
 
+	// Visit the vertices connected to a given vertex without building a set (see Graph.h).
+	long for_each_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		long slot=vindex.find(v);
+		if (slot<0) return -1;
+		return visit_deps(gra[slot].begin(),gra[slot].end(),gra_out[slot].begin(),gra_out[slot].end(),\
+			v,visitor,neighbor);
+	};
+	long for_each_in_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		long slot=vindex.find(v);
+		if (slot<0) return -1;
+		return visit_deps(gra[slot].begin(),gra[slot].end(),v,visitor,neighbor);
+	};
+	long for_each_out_dep(NodeID v, NeighborVisitor &visitor, bool neighbor=false) const {
+		long slot=vindex.find(v);
+		if (slot<0) return -1;
+		return visit_deps(gra_out[slot].begin(),gra_out[slot].end(),v,visitor,neighbor);
+	};
+
 	// Find degree information.
 	// Find the number of degrees for a given vertex. 
 	// Returns -1 if the vertex doesn't exist.
@@ -148,10 +227,18 @@ class GraphVDS : public GraphV {
 	bool read2(std::istream &ifile);
 
    private :
+	// Count the edges between the given neighbors (used for find_*neighbor_connections).
+	long count_connections(const NodeIDMSet &deps) const;
+
    	// Information about in-edges and out-edges for each vertex. 
 	// By having both, we gain speed but lose some memory space.
-	std::map<NodeID,NodeIDLinkIDMMap> gra;
-	std::map<NodeID,NodeIDLinkIDMMap> gra_out;
+	// (Stored for each slot, see GraphV::vindex.)
+	std::vector<NodeIDLinkIDMMap> gra;
+	std::vector<NodeIDLinkIDMMap> gra_out;
+
+	// To get the end points from ID (only when if_index=true).
+	bool if_index;
+	EdgeIndex links_info;
 
    	
 };
@@ -27,6 +27,10 @@
 #include "GraphFB.h"
 #include "GraphFD.h"
 #include "GraphFDS.h"
+#include "GraphCSR.h"
+#include "GraphCompressed.h"
+#include "GraphSV.h"
+#include "GraphDense.h"
 #include "Types.h"
 #include "TimeSeq.h"
 #include "Errors.h"
@@ -223,6 +227,17 @@ class GraphsFixed: virtual public Graphs {
 		else return false;
 	};
 
+	// Replace the graph of the given type by a read-only graph (constructed elsewhere, e.g. GraphFB_CSR),
+	//	frozen from the current graph (to be used after the initialization).
+	// Edges of the original graph are cleared to release the memory.
+	bool freeze_graph(LinkType lt, Graph *pg) {
+		if (!if_fixed_type(lt)) throw Bad_Link_Type();
+		if (!pg->freeze(*fgraphs[lt])) return false;
+		fgraphs[lt]->clear_edges();
+		fgraphs[lt]=pg;
+		return true;
+	};
+
 	// Advance without change (not needed).
 	void advance(TimeType t, bool if_copy=true) {};
 	void advance_L(LinkType lt, TimeType t, bool if_copy=true) {};
@@ -336,6 +351,13 @@ class GraphsVarying: virtual public Graphs {
 		return true;
 	};
 
+	// Set the delta mode for the given type (see TimeSeqGraphs): when links change a little
+	//	at each time step, advancing with copying will only apply the changes.
+	void set_delta_mode(LinkType lt, bool dm=true) {
+		if (!if_varying_type(lt)) throw Bad_Link_Type();
+		vgraphs[lt].set_delta_mode(dm);
+	};
+
 	// Advance without change upto the given time if some graphs are not already updated (for varying graphs only).
 	void advance(TimeType t, bool if_copy=true) {
 		for (std::map<LinkType,TimeSeqGraphs>::iterator i=vgraphs.begin();i!=vgraphs.end();i++)
@@ -675,6 +697,85 @@ class Graphs_Ex5: public GraphsFixedVarying {
    	GraphFD g2; // To be used for the fixed graph (directional)
 };
 
+// Example:
+// Same as Graphs_Ex4, but the fixed graph (LinkType=1) can be frozen into the CSR format after 
+//	the initialization (freeze() should be called after all links of type 1 are added at t=0).
+class Graphs_Ex6: public GraphsFixedVarying {
+   public:
+   	// Constructor.
+   	Graphs_Ex6(NodeID nv, TimeType &t): GraphsFixedVarying(t), g1s(2), g2(nv) { // nv: number of nodes.
+		std::vector<Graph *> pg1s(2);
+		for (long i=0;i<2;i++) {
+			g1s[i].reset(nv);
+			g1s[i].set_edge_type(0);
+			pg1s[i]=&g1s[i];
+		};
+		GraphsVarying::assign_graph_V(0,pg1s,1);
+		g2.set_edge_type(1);
+		GraphsFixed::assign_graph_F(1,&g2);
+	};
+
+	// Destructor.
+	~Graphs_Ex6() {};
+
+	// Freeze the fixed graph (LinkType=1).
+	bool freeze() {
+		return GraphsFixed::freeze_graph(1,&g2_csr);
+	};
+
+	// Only dealing with ID-less links.
+	bool add_link(LinkID id, LinkType lt, TimeType t, NodeID ori, NodeID des) {
+		return false;
+	};
+	bool remove_link(LinkID id, LinkType lt, TimeType t, NodeID ori, NodeID des) {
+		return false;
+	};
+
+   private:
+	std::vector<GraphFB> g1s;	// To be used for the time sequence of the varying graph.
+   	GraphFB g2; // To be used for the fixed graph during the initialization.
+   	GraphFB_CSR g2_csr; // To be used for the fixed graph after freezing.
+};
+
+// Example:
+// Same as Graphs_Ex0, but using graphs with sorted-vector adjacency lists (GraphFB_SV & GraphFD_SV),
+//	which are better when links are rewired often.
+class Graphs_Ex7: public GraphsVarying {
+   public:
+   	// Constructor.
+	// nv: number of nodes, if_loop & if_multilink: for the directional graph (LinkType=1).
+   	Graphs_Ex7(NodeID nv, TimeType &t, bool if_multilink=false, bool if_loop=false): GraphsVarying(t), g1(2), g2(2) { 
+		std::vector<Graph *> pg1(2), pg2(2);
+		for (long i=0;i<2;i++) {
+			g1[i].reset(nv);
+			g2[i].reset(nv);
+			g2[i].set_multi_link(if_multilink);
+			g2[i].set_loop(if_loop);
+			g1[i].set_edge_type(0);
+			g2[i].set_edge_type(1);
+			pg1[i]=&g1[i];
+			pg2[i]=&g2[i];
+		};
+		GraphsVarying::assign_graph_V(0,pg1,1); // LinkType=0
+		GraphsVarying::assign_graph_V(1,pg2,1); // LinkType=1
+	};
+
+	// Destructor.
+	~Graphs_Ex7() {};
+
+	// Only dealing with ID-less links.
+	bool add_link(LinkID id, LinkType lt, TimeType t, NodeID ori, NodeID des) {
+		return false;
+	};
+	bool remove_link(LinkID id, LinkType lt, TimeType t, NodeID ori, NodeID des) {
+		return false;
+	};
+
+   private:
+   	std::vector<GraphFB_SV> g1;
+	std::vector<GraphFD_SV> g2;
+};
+
 
 }; // End of namespace conet.
 #endif
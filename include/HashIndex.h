@@ -0,0 +1,150 @@
+//
+//	CONETSIM - HashIndex.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include <vector>
+
+namespace conet {
+
+// Hash table that maps non-negative IDs (NodeID, LinkID) to long values.
+// Open addressing with linear probing is used (keys and values are stored in two arrays),
+//	and the table grows when more than a half is used.
+// Removed keys are not marked; following keys are moved back instead, so lookups stay short.
+class HashIndex {
+   public :
+	// Constructor (n: expected number of keys).
+	HashIndex(long n=0) : nkeys(0) {
+		this->rehash(table_size(n));
+	};
+
+	// Get the number of keys.
+	long size() const {
+		return nkeys;
+	};
+
+	// Find the value for a given key (returns -1 if the key doesn't exist).
+	long find(long key) const {
+		unsigned long i=hash(key)&mask;
+		while (keys[i]!=EMPTY) {
+			if (keys[i]==key) return values[i];
+			i=(i+1)&mask;
+		};
+		return -1;
+	};
+
+	// Insert a key with a value (the value is replaced if the key already exists).
+	// Returns false if the key already exists.
+	bool insert(long key, long value) {
+		if (2*(nkeys+1)>long(keys.size())) this->rehash(2*keys.size());
+		unsigned long i=hash(key)&mask;
+		while (keys[i]!=EMPTY) {
+			if (keys[i]==key) {
+				values[i]=value;
+				return false;
+			};
+			i=(i+1)&mask;
+		};
+		keys[i]=key;
+		values[i]=value;
+		nkeys++;
+		return true;
+	};
+
+	// Remove a key (returns false if the key doesn't exist).
+	bool erase(long key) {
+		unsigned long i=hash(key)&mask;
+		while (keys[i]!=key) {
+			if (keys[i]==EMPTY) return false;
+			i=(i+1)&mask;
+		};
+		// Move following keys back to fill the hole.
+		unsigned long j=i;
+		while (true) {
+			j=(j+1)&mask;
+			if (keys[j]==EMPTY) break;
+			unsigned long k=hash(keys[j])&mask;
+			// Move keys[j] to i if its home position k is not in (i,j] (cyclically).
+			if ((i<=j)? (i<k && k<=j) : (i<k || k<=j)) continue;
+			keys[i]=keys[j];
+			values[i]=values[j];
+			i=j;
+		};
+		keys[i]=EMPTY;
+		nkeys--;
+		return true;
+	};
+
+	// Remove all keys.
+	void clear() {
+		keys.assign(keys.size(),long(EMPTY));
+		nkeys=0;
+	};
+
+	// Make sure that n keys can be inserted without growing the table.
+	void reserve(long n) {
+		if (table_size(n)>long(keys.size())) this->rehash(table_size(n));
+	};
+
+	// Find all keys (not sorted).
+	void find_keys(std::vector<long> &ks) const {
+		ks.clear();
+		for (unsigned long i=0;i<keys.size();i++)
+			if (keys[i]!=EMPTY) ks.push_back(keys[i]);
+	};
+
+   private:
+	// Mark for empty positions.
+	static const long EMPTY=-1;
+
+	// Hash function (multiplicative hashing).
+	static unsigned long hash(long key) {
+		unsigned long h=(unsigned long)key*2654435761UL;
+		return h^(h>>16);
+	};
+
+	// Size of the table for n keys (a power of 2, at least 2n).
+	static long table_size(long n) {
+		long s=8;
+		while (s<2*n) s*=2;
+		return s;
+	};
+
+	// Rebuild the table with a new size.
+	void rehash(long s) {
+		std::vector<long> old_keys(s,long(EMPTY)), old_values(s);
+		old_keys.swap(keys);
+		old_values.swap(values);
+		mask=s-1;
+		nkeys=0;
+		for (unsigned long i=0;i<old_keys.size();i++)
+			if (old_keys[i]!=EMPTY) this->insert(old_keys[i],old_values[i]);
+	};
+
+	std::vector<long> keys;		// Keys (EMPTY when not used).
+	std::vector<long> values;	// Values.
+	long nkeys;			// Number of keys.
+	unsigned long mask;		// Size of the table minus 1.
+};
+
+}; // End of namespace conet.
+#endif
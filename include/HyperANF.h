@@ -0,0 +1,83 @@
+//
+//	CONETSIM - HyperANF.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef HYPERANF_H
+#define HYPERANF_H
+
+#include "Graph.h"
+#include "SlotLists.h"
+#include "Types.h"
+#include <vector>
+
+namespace conet {
+
+// Approximate neighbourhood function (HyperANF): each vertex keeps a HyperLogLog counter
+//	(2^log2m registers of one byte) of the vertices reachable within t steps, and at each
+//	step the counter is joined (register-wise maximum) with those of its outward connected
+//	vertices. N(t), the number of pairs with distance not larger than t, is the sum of
+//	the counters, so the distance distribution is found in O(diameter*E) time with
+//	O(V*2^log2m) memory (relative error of each counter: 1.04/sqrt(2^log2m)).
+// Only vertices whose connected vertices changed in the previous step are updated, and
+//	vertices are divided among threads with OpenMP.
+// The graph should not be changed while this object is used.
+class HyperANF {
+   public :
+	// Constructor (log2m: from 4 to 16; seed changes the hash function, so that runs with
+	//	different seeds can be averaged).
+	HyperANF(const Graph &gr, int log2m=6, unsigned long seed=0);
+
+	// Run steps until no counter changes (or up to max_dist steps when max_dist>=0).
+	// Returns the number of steps (the diameter when no counter changes).
+	long run(long max_dist=-1);
+
+	// Get the neighbourhood function: N(t) for t=0,1,...,(number of steps).
+	const std::vector<double> & get_neighborhood() const {
+		return neighborhood;
+	};
+
+	// Find the distribution of distances: dist[d] is the number of pairs with distance d
+	//	(dist[0]: number of vertices).
+	void find_distance_distribution(std::vector<double> &dist) const;
+
+	// Find the mean distance for all reachable pairs.
+	double find_mean_distance() const;
+
+	// Find the effective diameter: the (interpolated) distance within which the fraction
+	//	alpha of reachable pairs are found.
+	double find_effective_diameter(double alpha=0.9) const;
+
+   private:
+	// Estimate the number of vertices in a counter.
+	double estimate(const unsigned char *c) const;
+
+	SlotLists lists;			// Outward connected slots of each slot.
+	long m;					// Number of registers for each counter.
+	int log2m;
+	std::vector<bool> used;			// Slots used by vertices.
+	std::vector<unsigned char> counters;	// Counters (m registers for each slot).
+	std::vector<unsigned char> modified;	// Slots changed in the last step.
+	std::vector<double> sizes;		// Estimated size of each counter.
+	std::vector<double> neighborhood;	// N(t).
+};
+
+}; // End of namespace conet.
+#endif
@@ -0,0 +1,212 @@
+//
+//	CONETSIM - IDAllocator.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef IDALLOCATOR_H
+#define IDALLOCATOR_H
+
+#include "Types.h"
+#include "HashIndex.h"
+#include <vector>
+#include <deque>
+#include <utility>
+
+namespace conet {
+
+// Allocator of IDs (NodeID, LinkID) for nodes and links whose number varies.
+// New IDs are taken from the list of released IDs (free list) first, and then 0, 1, 2, ... are used,
+//	so both allocating and releasing are O(1), and IDs stay small (they can be used as indexes).
+// A released ID can be reused only after the given number of time steps (window, max_delay
+//	for nodes and links), so an object that reads states of the past with delays never finds
+//	a new node or link with the ID of the removed one.
+// IDs can be also given by users (take). States of IDs are stored in an array up to the largest one
+//	only when it is not far beyond next; larger ones are kept in a hash table until next reaches them.
+class IDAllocator {
+   public :
+	// Constructor (w: number of time steps before a released ID can be reused).
+	IDAllocator(TimeType w=0) : window(w), next(0), status(), free_ids(), pending(), far() {};
+
+	// Set or get the window.
+	void set_window(TimeType w) {
+		window=w;
+	};
+	TimeType get_window() const {
+		return window;
+	};
+
+	// Forget all IDs.
+	void clear() {
+		next=0;
+		status.clear();
+		free_ids.clear();
+		pending.clear();
+		far.clear();
+	};
+
+	// Check if the ID is used (or released, but not reusable yet).
+	bool if_used(long id) const {
+		if (id<0) return false;
+		if (id<next) return (status[id]!=FREE);
+		return (far.size()>0 && far.find(id)>=0);
+	};
+
+	// Find the ID that will be allocated next at the time t (it is not used until it is taken).
+	// Returns -1 if there is no available ID.
+	long find_new(TimeType t) {
+		this->recycle(t);
+		// IDs taken by users can be in the free list.
+		while (!free_ids.empty() && status[free_ids.back()]!=FREE) free_ids.pop_back();
+		if (!free_ids.empty()) return free_ids.back();
+		while (far.size()>0 && far.find(next)>=0) this->extend(next+1); // Skip IDs taken by users.
+		if (next+1<0) return -1; // The maximum value has been reached.
+		return next;
+	};
+
+	// Allocate a new ID at the time t (returns -1 if there is no available ID).
+	long allocate(TimeType t) {
+		long id=this->find_new(t);
+		if (id>=0) this->take(id,t);
+		return id;
+	};
+
+	// Allocate n new IDs at once at the time t (returns the number of IDs allocated).
+	long allocate(long n, TimeType t, std::vector<long> &ids) {
+		ids.clear();
+		this->recycle(t);
+		while (long(ids.size())<n && !free_ids.empty()) {
+			long id=free_ids.back();
+			free_ids.pop_back();
+			if (status[id]==FREE) {
+				status[id]=USED;
+				ids.push_back(id);
+			};
+		};
+		long m=n-ids.size();
+		if (m>0 && far.size()==0 && next+m>0) { // New IDs in one block.
+			for (long id=next;id<next+m;id++) ids.push_back(id);
+			status.resize(next+m,char(USED));
+			next+=m;
+		};
+		while (long(ids.size())<n) { // IDs taken by users are skipped.
+			long id=this->allocate(t);
+			if (id<0) break;
+			ids.push_back(id);
+		};
+		return ids.size();
+	};
+
+	// Find n IDs that will be allocated next at the time t (they are not used until they are taken).
+	long find_new(long n, TimeType t, std::vector<long> &ids) {
+		this->allocate(n,t,ids);
+		for (long i=long(ids.size())-1;i>=0;i--) { // ids[0] will be on the top of the free list.
+			status[ids[i]]=FREE;
+			free_ids.push_back(ids[i]);
+		};
+		return ids.size();
+	};
+
+	// Take the given ID at the time t (returns false if it is used, or released but not reusable yet).
+	bool take(long id, TimeType t) {
+		if (id<0) return false;
+		this->recycle(t);
+		if (id>=next) {
+			if (id-next>=next+FAR_IDS) { // Too far from next.
+				if (far.size()>0 && far.find(id)>=0) return false;
+				far.insert(id,USED);
+				return true;
+			};
+			this->extend(id+1);
+		};
+		if (status[id]!=FREE) return false;
+		status[id]=USED;
+		return true;
+	};
+
+	// Release the ID at the time t (it can be reused at t+window).
+	bool release(long id, TimeType t) {
+		if (id<0) return false;
+		if (id>=next) { // Given ID in the hash table.
+			if (far.size()==0 || far.find(id)!=USED) return false;
+			if (window<=0) far.erase(id);
+			else {
+				far.insert(id,PENDING);
+				pending.push_back(std::make_pair(t+window,id));
+			};
+			return true;
+		};
+		if (status[id]!=USED) return false;
+		if (window<=0) {
+			status[id]=FREE;
+			free_ids.push_back(id);
+		}
+		else {
+			status[id]=PENDING;
+			pending.push_back(std::make_pair(t+window,id));
+		};
+		return true;
+	};
+
+   private:
+	// Move released IDs that can be reused at t to the free list.
+	// (IDs are released in the order of time, so they are in the order of reusable times, too.)
+	void recycle(TimeType t) {
+		while (!pending.empty() && pending.front().first<=t) {
+			long id=pending.front().second;
+			pending.pop_front();
+			if (id>=next) far.erase(id); // IDs beyond next are free when not in the hash table.
+			else {
+				status[id]=FREE;
+				free_ids.push_back(id);
+			};
+		};
+	};
+
+	// Make states of IDs up to n-1 (states in the hash table are moved; other IDs skipped are free).
+	void extend(long n) {
+		long n0=next;
+		status.resize(n,char(FREE));
+		next=n;
+		for (long i=n0;i<n;i++) {
+			long st=(far.size()>0)? far.find(i) : -1;
+			if (st>=0) {
+				status[i]=char(st);
+				far.erase(i);
+			}
+			else	free_ids.push_back(i);
+		};
+	};
+
+	// Status of IDs.
+	enum { FREE=0, USED=1, PENDING=2 };
+
+	// Given IDs beyond 2*next+FAR_IDS are kept in the hash table.
+	static const long FAR_IDS=64;
+
+	TimeType window;		// Number of time steps before a released ID can be reused.
+	long next;			// IDs from next are never used.
+	std::vector<char> status;	// Status of IDs (0,...,next-1).
+	std::vector<long> free_ids;	// Free list of released IDs.
+	std::deque<std::pair<TimeType,long> > pending;	// Released IDs with times when they can be reused.
+	HashIndex far;			// States of given IDs beyond next (FREE ones are not stored).
+};
+
+}; // End of namespace conet.
+#endif
@@ -362,12 +362,14 @@ template<class State> class LinkF {
 // For State class, default constructor should be given, operator= (copy constructor), operator<<, operator>>
 //	should be overloaded (operator less than can be handy, too).
 // There are two choices for subclasses: LinkF or LinkV (depending on whether states change with time or not).
-template<class State> class LinkV {
+// Seq is the class for the time sequence: TimeSeq<State> (default), or TimeSeqFixed<State,N>
+//	when max_delay is known at compile time.
+template<class State, class Seq=TimeSeq<State> > class LinkV {
    public:
    	// Constructor.
-	LinkV(): states(LinkV<State>::get_default_size(),State(),0) {};
+	LinkV(): states(LinkV::get_default_size(),State(),0) {};
 	LinkV(TimeType ss, const State &val, TimeType ft=0): states(ss,val,ft) {};
-	LinkV(const LinkV<State> &link): states(link.get_size(),State(),link.get_first_time()) {
+	LinkV(const LinkV &link): states(link.get_size(),State(),link.get_first_time()) {
 		for (TimeType t=get_first_time();t<=get_last_time();t++)
 			states.add_value(t,link(t));
 	};
@@ -376,18 +378,23 @@ template<class State> class LinkV {
 	~LinkV() {};
 
 	// copy the object.
-	void copy(const LinkV<State> &link) {
+	void copy(const LinkV &link) {
 		reset(link.get_size(),link.get_first_time());
 		for (TimeType t=get_first_time();t<=get_last_time();t++)
 			states.add_value(t,link(t));
 	};
 
+	// Exchange states with another link.
+	void swap(LinkV &link) {
+		states.swap(link.states);
+	};
+
 	// Get the state
 	State get_state() const {
 		return states.get_last_value(); // Not well-defined (do not use it).;
 	};
 	State get_state_T(TimeType t) const {
-		if (states.range(t)) return states(t);
+		if (states.range(t)) return states.access(t);
 		else throw TimeSeq_Range_Error();
 	};
 
@@ -396,7 +403,7 @@ template<class State> class LinkV {
 		return states.get_last_value(); // Not well-defined (do not use it).;
 	};
 	State & access_state_T(TimeType t) {
-		if (states.range(t)) return states(t);
+		if (states.range(t)) return states.access(t);
 		else throw TimeSeq_Range_Error();
 	};
 
@@ -462,7 +469,7 @@ template<class State> class LinkV {
 	}; 
 
    protected:
-   	TimeSeq<State> states; // Time sequence of states for a given node. 
+   	Seq states; // Time sequence of states for a given node. 
 };
 
 // Class that represents links with delay=1 and time-fixed states.
@@ -576,23 +583,32 @@ template<class State> class LinkDF: public LinkD, public LinkF<State> {
 };
 
 // Class that represents links with inhomogenous delays and time-varying states.
-template<class State> class LinkDV: public LinkD, public LinkV<State> {
+// (Seq: class for the time sequence, see LinkV.)
+template<class State, class Seq=TimeSeq<State> > class LinkDV: public LinkD, public LinkV<State,Seq> {
    public:
    	// Constructor.
-	LinkDV(): LinkD(1), LinkV<State>(LinkDV<State>::get_default_size(),State(),0) {};
-	LinkDV(TimeType ss, const State &val, TimeType ft=0, DelayType d=1): LinkD(d), LinkV<State>(ss,val,ft) {}; // ss; time sequence size
-	LinkDV(const LinkDV<State> &link): LinkD(link.get_delay()), LinkV<State>(link.get_size(),State(),link.get_first_time()) {
-		for (TimeType t=LinkV<State>::get_first_time();t<=LinkV<State>::get_last_time();t++)
-			LinkV<State>::states.add_value(t,link.access_state_T(t));
+	LinkDV(): LinkD(1), LinkV<State,Seq>(LinkDV::get_default_size(),State(),0) {};
+	LinkDV(TimeType ss, const State &val, TimeType ft=0, DelayType d=1): LinkD(d), LinkV<State,Seq>(ss,val,ft) {}; // ss; time sequence size
+	LinkDV(const LinkDV &link): LinkD(link.get_delay()), LinkV<State,Seq>(link.get_size(),State(),link.get_first_time()) {
+		for (TimeType t=LinkV<State,Seq>::get_first_time();t<=LinkV<State,Seq>::get_last_time();t++)
+			LinkV<State,Seq>::states.add_value(t,link.access_state_T(t));
 	};
 
 	// Destructor.
 	~LinkDV() {};
 	
 	// copy the object.
-	void copy(const LinkDV<State> &link) {
+	void copy(const LinkDV &link) {
 		LinkD::copy(link);
-		LinkV<State>::copy(link);
+		LinkV<State,Seq>::copy(link);
+	};
+
+	// Exchange delays and states with another link.
+	void swap(LinkDV &link) {
+		DelayType d=this->get_delay();
+		this->set_delay(link.get_delay());
+		link.set_delay(d);
+		LinkV<State,Seq>::swap(link);
 	};
 
 	// Show the link type (This should be redefined in subclasses.)
@@ -783,14 +799,14 @@ template<class State> class LinkDVR: public LinkDV<State>, public LinkR {
 template<class State> LinkType LinkBF<State>::type;
 template<class State> LinkType LinkBV<State>::type;
 template<class State> LinkType LinkDF<State>::type;
-template<class State> LinkType LinkDV<State>::type;
+template<class State, class Seq> LinkType LinkDV<State,Seq>::type;
 template<class State> LinkType LinkBFR<State>::type;
 template<class State> LinkType LinkBVR<State>::type;
 template<class State> LinkType LinkDFR<State>::type;
 template<class State> LinkType LinkDVR<State>::type;
 
 template<class State> DelayType LinkBV<State>::default_size;
-template<class State> DelayType LinkDV<State>::default_size;
+template<class State, class Seq> DelayType LinkDV<State,Seq>::default_size;
 template<class State> DelayType LinkBVR<State>::default_size;
 template<class State> DelayType LinkDVR<State>::default_size;
 
@@ -26,10 +26,14 @@
 #include "Link.h"
 #include "TimeSeq.h"
 #include "Types.h"
+#include "SlotMap.h"
+#include "IDAllocator.h"
 #include <istream>
 #include <ostream>
 #include <iostream>
 #include <map>
+#include <vector>
+#include <algorithm>
 
 namespace conet {
 
@@ -65,12 +69,13 @@ struct TypeInfo {
 class Links {
    public:
    	// Constructor.
-   	Links(TimeType &t): time(t), nlinks(), typeinfos(), max_ID(-1), current_greatest_ID(-1) {};
-   	Links(TimeType &t, const std::map<LinkType,DelayType> &mds): time(t), typeinfos(), max_ID(-1), current_greatest_ID(-1) {
+   	Links(TimeType &t): time(t), nlinks(), typeinfos(), ids() {};
+   	Links(TimeType &t, const std::map<LinkType,DelayType> &mds): time(t), typeinfos(), ids() {
 		for (std::map<LinkType,DelayType>::const_iterator i=mds.begin();i!=mds.end();i++) {
 			nlinks[i->first]=0;
 			typeinfos[i->first]=TypeInfo(i->second,false); // assuming links have IDs here.
 		};
+		this->set_id_window();
 	};
 
 	// Virtual destructor.
@@ -81,6 +86,7 @@ class Links {
 		if (nlinks.find(lt)!=nlinks.end()) return false;
 		nlinks[lt]=0;
 		typeinfos[lt]=TypeInfo(md,noid);
+		this->set_id_window();
 		return true;
 	};
 
@@ -100,6 +106,11 @@ class Links {
 		return time;
 	};
 
+	// Access the ID allocator (e.g. to change the window for reusing IDs).
+	IDAllocator & access_id_allocator() {
+		return ids;
+	};
+
 	// Get the number of LinkType's.
 	LinkType get_ntypes() const {
 		return nlinks.size();
@@ -132,6 +143,7 @@ class Links {
 			if (md[lt]>=1)  typeinfos[lt]=md[lt];
 			else return false;
 		};
+		this->set_id_window();
 		return true;
 	};
 
@@ -151,6 +163,7 @@ class Links {
 	void clear_all() {
 		for (std::map<LinkType,LinkID>::iterator i=nlinks.begin();i!=nlinks.end();i++)
 			this->clear(i->first);
+		ids.clear();
 	};
 	virtual void clear(LinkType lt) {
 		if (!this->if_type(lt)) throw Bad_Link_Type();
@@ -169,8 +182,8 @@ class Links {
 		if (!if_type(lt) || if_type_noID(lt)) throw Bad_Link_Type();
 		if (id<0 || this->if_ID(id)) return false; // ID not allowed
 		if (!Links::delay_check(lt,d)) return false;
+		if (!ids.take(id,time)) return false; // ID removed in the last max_delay steps.
 		nlinks[lt]++;
-		if (current_greatest_ID<id) current_greatest_ID=id;
 		return true;
 	};
 	// For links with ID, when id will be chosen automatically.
@@ -181,7 +194,19 @@ class Links {
 			id=new_id;
 			return this->add_link(new_id,lt,t,d);
 		}
-		else	false;
+		else	return false;
+	};
+	// For links with ID, when n links are added with new IDs at once (returns the number of links added;
+	//	IDs are stored in idv). add_link is called for each ID, so subclasses store links as usual.
+	long add_links_generatedID(std::vector<LinkID> &idv, long n, LinkType lt, TimeType t, DelayType d=1) {
+		if (!if_type(lt) || if_type_noID(lt)) throw Bad_Link_Type();
+		if (!Links::delay_check(lt,d)) return 0;
+		ids.find_new(n,time,idv);
+		long nadded=0;
+		for (unsigned long i=0;i<idv.size();i++)
+			if (this->add_link(idv[i],lt,t,d)) idv[nadded++]=idv[i];
+		idv.resize(nadded);
+		return nadded;
 	};
 	// For links with no ID (special case when there is no link state and delays are all 1).
 	bool add_link_noID(LinkType lt, TimeType t) {
@@ -196,7 +221,10 @@ class Links {
 	// 	hence past states of that link can be deleted.
 	virtual bool remove_link(LinkID id, LinkType lt, TimeType t) {
 		if (!if_type(lt) || if_type_noID(lt)) throw Bad_Link_Type();
-		if (if_ID(id)) nlinks[lt]--;
+		if (if_ID(id)) {
+			nlinks[lt]--;
+			ids.release(id,time); // It can be reused after the max_delay.
+		};
 		return true;
 	};
 	// For links with no ID.
@@ -222,20 +250,18 @@ class Links {
 
    protected:
    	// Finding a new ID (new ID should not already exist).
+	// IDs of removed links are reused after the max_delay (of all types).
 	// Returns -1, if there is no available ID.
    	LinkID find_new_ID() {
-		// Before the current_greates_ID reaches the maximum value for the given LinkID type.
-		if (max_ID==-1) { // Maximum possible value hasn't been reached
-			if (++current_greatest_ID<0)  // Maximum possible value has been reached here.
-				max_ID=current_greatest_ID--; 	// Max_ID is set as the maximum possible value.
-			else return current_greatest_ID;
-		}
-		// After the max_ID has been reached, we have to find an unused ID.
-		//	(Expensive, it can be better.)
-		else 
-			for (LinkID id=0;id<=max_ID;id++)
-				if (!(this->if_ID(id))) return id; 
-		return -1;
+		return ids.find_new(time);
+	};
+
+	// IDs of removed links are reused after the largest max_delay.
+	void set_id_window() {
+		DelayType md=0;
+		for (std::map<LinkType,TypeInfo>::const_iterator i=typeinfos.begin();i!=typeinfos.end();i++)
+			if (md<(i->second).max_delay) md=(i->second).max_delay;
+		ids.set_window(md);
 	};
 
    protected:
@@ -245,8 +271,7 @@ class Links {
 
 	std::map<LinkType,TypeInfo> typeinfos; // Maximum delays for eacy type.
 
-	LinkID max_ID;	// maximum value for the LinkID type.
-	LinkID current_greatest_ID;	// current greatest ID.
+	IDAllocator ids;	// IDs of links.
 };
 
 // A derived template class of "Links" for links that only has one Link state involved (Links1S).
@@ -288,7 +313,7 @@ template<class State> class Links1S: public Links {
 			id=new_id;
 			return this->add_link_S(new_id,lt,t,s,d);
 		}
-		else	false;
+		else	return false;
 	};
 
 	// Get the state of the given link.
@@ -349,7 +374,7 @@ template<class State1, class State2> class Links2S: public Links1S<State1> {
 			id=new_id;
 			return this->add_link_S2(new_id,lt,t,s,d);
 		}
-		else	false;
+		else	return false;
 	};
 
 	// Get the state of the given link.
@@ -508,7 +533,8 @@ class LinkDs : public Links {
 
 // Example3:
 // Subclass of Links1S: it contains one type of the fixed number of links with inhomogeneous delays and State. (no RNG)
-template<class State> class LinkDVSs : public Links1S<State> {
+//	(Seq: class for the time sequence of each link, see LinkV.)
+template<class State, class Seq=TimeSeq<State> > class LinkDVSs : public Links1S<State> {
    public:
    	// Constructor.
 	// There is only one type.
@@ -568,7 +594,8 @@ template<class State> class LinkDVSs : public Links1S<State> {
 		if (t!=0 || id!=Links1S<State>::nlinks[lt]) return false;
 		if (Links::add_link(id,lt,t,d)) {
 			linkset.resize(id+1);
-			linkset[id]=LinkDV<State>(Links1S<State>::typeinfos[lt].max_delay+1,s,t,d);
+			LinkDV<State,Seq> link(Links1S<State>::typeinfos[lt].max_delay+1,s,t,d);
+			linkset[id].swap(link);
 			return true;
 		}
 		else	return false; // cannot be added.
@@ -635,11 +662,12 @@ template<class State> class LinkDVSs : public Links1S<State> {
 	};
 
    protected:
-   	std::vector<LinkDV<State> > linkset;
+   	std::vector<LinkDV<State,Seq> > linkset;
 };
 
 // Example4:
 // Subclass of Links1S: it contains one type of the VARYING number of links with inhomogeneous delays and changing state (with RNG).
+// Links are stored in a SlotMap, so finding, adding and removing a link are O(1), and advance goes over a dense array.
 template<class State> class LinkDVRSs : public Links1S<State> {
    public:
    	// Constructor.
@@ -657,7 +685,7 @@ template<class State> class LinkDVRSs : public Links1S<State> {
 
    	// Find if the given ID already exists.
    	bool if_ID(LinkID id) const {
-		return (linkset.find(id)!=linkset.end());
+		return linkset.if_key(id);
 	};
   
    	// Deleting all links at the current time.
@@ -669,15 +697,15 @@ template<class State> class LinkDVRSs : public Links1S<State> {
 	// Advancing the time to the given time for all current link objects, if needed.
 	void advance(TimeType t) {
 		if (Links1S<State>::time>t) return;
-		for (typename std::map<LinkID,LinkDVR<State> >::iterator i=linkset.begin();i!=linkset.end();i++) {
-			if ((i->second).get_last_time()<t) { // outside the range of the time sequence
-				while ((i->second).get_last_time()<t)
-					(i->second).advance_without_change();
+		for (LinkDVR<State> *i=linkset.begin();i!=linkset.end();i++) {
+			if (i->get_last_time()<t) { // outside the range of the time sequence
+				while (i->get_last_time()<t)
+					i->advance_without_change();
 			}
 			else { 	// If the time is still inside the range of the time sequence.
 				// Assumes that time advances with 1 and 
 				// that the weight value is kept from the previous valule.
-				(i->second).set_state_T((i->second).access_state_T(t-1),t);
+				i->set_state_T(i->access_state_T(t-1),t);
 			};
 		};
 	};
@@ -693,9 +721,9 @@ template<class State> class LinkDVRSs : public Links1S<State> {
 	};
 	bool add_link_S(LinkID id, LinkType lt, TimeType t, const State &s, DelayType d=1) {
 		if (lt!=Links1S<State>::get_type_S()) throw Bad_Link_Type(); // There is only one type.
+		if (!linkset.if_free(id)) return false; // The ID is used (any other non-negative ID can be a key).
 		if (Links::add_link(id,lt,t,d)) {
-			pair<typename map<LinkID,LinkDVR<State> >::iterator,bool> temp= \
-				linkset.insert(typename map<LinkID,LinkDVR<State> >::value_type(id,LinkDVR<State>(Links1S<State>::typeinfos[lt].max_delay+1,s,t,d)));  
+			linkset.insert(id,LinkDVR<State>(Links1S<State>::typeinfos[lt].max_delay+1,s,t,d));
 			return true;
 		}
 		else	return false; // cannot be added.
@@ -705,7 +733,7 @@ template<class State> class LinkDVRSs : public Links1S<State> {
 	bool remove_link(LinkID id, LinkType lt, TimeType t) {
 		if (lt!=Links1S<State>::get_type_S()) throw Bad_Link_Type();
 		if (Links::remove_link(id,lt,t)) {
-			linkset.erase(linkset.find(id));
+			linkset.erase(id);
 			return true;
 		}
 		else	return false; // none existing.
@@ -715,7 +743,7 @@ template<class State> class LinkDVRSs : public Links1S<State> {
 	DelayType get_delay(LinkID id, LinkType lt) const {
 		if (lt!=Links1S<State>::get_type_S()) throw Bad_Link_Type();
 		if (!if_ID(id)) throw Bad_Link_ID();	// non-existing ID. 
-		return linkset[id].get_delay();
+		return linkset.access(id).get_delay();
 	};
 
 	// Set the delay of the given link. Return false, if failed.
@@ -723,53 +751,52 @@ template<class State> class LinkDVRSs : public Links1S<State> {
 		if (lt!=Links1S<State>::get_type_S()) throw Bad_Link_Type();
 		if (!if_ID(id)) throw Bad_Link_ID();	// non-existing ID. 
 		if (!Links::delay_check(lt,d)) return false;
-		linkset[id].set_delay(d);
+		linkset.access(id).set_delay(d);
+		return true;
 	};
 	
 	// Get the Link state of the given link.
 	State get_state(LinkID id, LinkType lt, TimeType t) const {
 		if (lt!=Links1S<State>::get_type_S()) throw Bad_Link_Type();
 		if (!if_ID(id)) throw Bad_Link_ID();	// non-existing ID. 
-		return linkset[id].access_state_T(t);
+		return linkset.access(id).get_state_T(t);
 	};
 
 	// Access the Link state of the given link.
 	State & access_state(LinkID id, LinkType lt, TimeType t) {
 		if (lt!=Links1S<State>::get_type_S()) throw Bad_Link_Type();
 		if (!if_ID(id)) throw Bad_Link_ID();	// non-existing ID. 
-		return linkset[id].access_state_T(t);
+		return linkset.access(id).access_state_T(t);
 	};
 
 	// Set the Link state of the given link using a double.
 	bool set_state(LinkID id, LinkType lt, TimeType t, const State &s) {
 		if (lt!=Links1S<State>::get_type_S()) throw Bad_Link_Type();
 		if (!if_ID(id)) throw Bad_Link_ID();	// non-existing ID. 
-		linkset[id].set_state_T(s,t);
+		linkset.access(id).set_state_T(s,t);
 		return true;
 	};
 
-	// Write the links info.
+	// Write the links info (in the order of IDs).
 	void write_T(std::ostream &of, TimeType t) const {
-		for (typename std::map<LinkID,LinkDVR<State> >::const_iterator i=linkset.begin();i!=linkset.end();i++) {
-			of << i->first << '\t' << get_delay(i->first,Links1S<State>::get_type_S()) << '\t';
-			if ((i->second).range(t))
-				of << (i->second).access_state_T(t) << '\n';
-			else
-				of << "NA" << '\n';
-		};
+		std::vector<LinkID> ids(linkset.access_keys());
+		std::sort(ids.begin(),ids.end());
+		for (unsigned long i=0;i<ids.size();i++)
+			write_ID_T(of,ids[i],t);
 	};
 	void write_ID_T(std::ostream &of, LinkID id, TimeType t) const {
 		if (if_ID(id)) {
-			of << id << '\t' << get_delay(id,Links1S<State>::get_type_S()) << '\t';
-			if (linkset[id].range(t))
-				of << linkset[id].access_state_T(t) << '\n';
+			const LinkDVR<State> &link=linkset.access(id);
+			of << id << '\t' << link.get_delay() << '\t';
+			if (link.range(t))
+				of << link.get_state_T(t) << '\n';
 			else
 				of << "NA" << '\n';
 		};
 	};
 
    protected:
-   	std::map<LinkID,LinkDVR<State> > linkset;
+   	SlotMap<LinkDVR<State> > linkset; // Links with their IDs (stored densely).
 };
 
 }; // End of namespace conet.
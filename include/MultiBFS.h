@@ -0,0 +1,74 @@
+//
+//	CONETSIM - MultiBFS.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef MULTIBFS_H
+#define MULTIBFS_H
+
+#include "Graph.h"
+#include "SlotLists.h"
+#include "Types.h"
+#include <vector>
+
+namespace conet {
+
+// Multi-source breadth-first search (MS-BFS): searches from up to 64 sources are run
+//	at the same time using a 64-bit mask for each vertex (bit i for the i-th source),
+//	so that each edge is read once per layer for all of them.
+// Outward connected vertices of each vertex are read once when the object is built (SlotLists.h).
+// The graph should not be changed while this object is used.
+class MultiBFS {
+   public :
+	// Mask of sources.
+	typedef unsigned long long Mask;
+
+	// Number of sources searched at the same time.
+	static const long NBITS=64;
+
+	// Constructor.
+	MultiBFS(const Graph &gr) : lists(gr) {};
+
+	// Get the number of slots.
+	long get_slot_size() const {
+		return lists.get_slot_size();
+	};
+
+	// Find the distribution of distances from given sources (slots) to all reachable
+	//	vertices, and add it to dist (dist[d]: number of pairs with distance d).
+	// With OpenMP, groups of 64 sources are divided among threads.
+	// Returns the largest distance found.
+	long add_distances(const std::vector<long> &sources, std::vector<long> &dist) const;
+
+	// Same as add_distances, but distributions are kept for each group of sources
+	//	(dists[g] for sources from g*group_size; group_size<=64), so that they can be used as samples.
+	long find_group_distances(const std::vector<long> &sources, \
+		std::vector<std::vector<long> > &dists, long group_size=NBITS) const;
+
+   private:
+	// Search from up to 64 sources (slots) using given masks (sizes: number of slots).
+	long search(const long *sources, long nsources, std::vector<Mask> &seen, \
+		std::vector<Mask> &visit, std::vector<Mask> &next, std::vector<long> &dist) const;
+
+	SlotLists lists;	// Outward connected slots of each slot.
+};
+
+}; // End of namespace conet.
+#endif
@@ -0,0 +1,137 @@
+//
+//	CONETSIM - NeighborVisitor.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+#ifndef NEIGHBORVISITOR_H
+#define NEIGHBORVISITOR_H
+
+#include "Types.h"
+#include <vector>
+#include <utility>
+
+namespace conet {
+
+// Visitor of vertices connected to a given vertex (used by Graph::for_each_dep functions),
+//	so that neighbors can be used without building a set for each call.
+class NeighborVisitor {
+   public :
+	// Virtual destructor.
+	virtual ~NeighborVisitor() {};
+
+	// Called for each connected vertex (return false to stop visiting).
+	virtual bool visit(NodeID v)=0;
+};
+
+// Visitor that stores vertices in a vector (memory is reused when the same object is used again).
+class NeighborVector : public NeighborVisitor {
+   public :
+	// Constructor.
+	NeighborVector() : deps() {};
+
+	bool visit(NodeID v) {
+		deps.push_back(v);
+		return true;
+	};
+
+	// Remove all vertices (memory is kept).
+	void clear() {
+		deps.clear();
+	};
+
+	std::vector<NodeID> deps;
+};
+
+// Functions used to implement for_each_dep functions on sorted adjacency containers
+//	(NodeIDMSet, NodeIDLinkIDMMap, AdjList, sorted arrays).
+
+// Vertex of an element of a container.
+inline NodeID dep_vertex(NodeID v) {
+	return v;
+};
+inline NodeID dep_vertex(const std::pair<const NodeID,LinkID> &p) {
+	return p.first;
+};
+
+// Number of edges for an element of a container.
+inline long dep_count(NodeID v) {
+	return 1;
+};
+inline long dep_count(const std::pair<const NodeID,LinkID> &p) {
+	return 1;
+};
+
+// Visit vertices in a sorted range [first,last) for a vertex v (loops and repeated vertices
+//	are ignored when neighbor=true). Returns the number of visits.
+template <class Iter>
+long visit_deps(Iter first, Iter last, NodeID v, NeighborVisitor &visitor, bool neighbor) {
+	long n=0;
+	NodeID prev=-1;
+	for (;first!=last;++first) {
+		NodeID u=dep_vertex(*first);
+		if (neighbor) {
+			if (u==v || u==prev) continue;
+			prev=u;
+			n++;
+			if (!visitor.visit(u)) return n;
+		}
+		else
+			for (long k=dep_count(*first);k>0;k--) {
+				n++;
+				if (!visitor.visit(u)) return n;
+			};
+	};
+	return n;
+};
+
+// Visit vertices in two sorted ranges (in the sorted order) for a vertex v
+//	(with neighbor=true, vertices in both ranges are visited once).
+template <class Iter1, class Iter2>
+long visit_deps(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2, NodeID v, \
+		NeighborVisitor &visitor, bool neighbor) {
+	long n=0;
+	NodeID prev=-1;
+	while (first1!=last1 || first2!=last2) {
+		NodeID u;
+		long count;
+		if (first2==last2 || (first1!=last1 && dep_vertex(*first1)<=dep_vertex(*first2))) {
+			u=dep_vertex(*first1);
+			count=dep_count(*first1);
+			++first1;
+		}
+		else {
+			u=dep_vertex(*first2);
+			count=dep_count(*first2);
+			++first2;
+		};
+		if (neighbor) {
+			if (u==v || u==prev) continue;
+			prev=u;
+			count=1;
+		};
+		for (;count>0;count--) {
+			n++;
+			if (!visitor.visit(u)) return n;
+		};
+	};
+	return n;
+};
+
+}; // End of namespace conet.
+#endif
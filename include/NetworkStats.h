@@ -0,0 +1,107 @@
+//
+//	CONETSIM - NetworkStats.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef NETWORKSTATS_H
+#define NETWORKSTATS_H
+
+#include "Graph.h"
+#include "Output.h"
+#include "Types.h"
+#include <vector>
+
+namespace conet {
+
+// Statistics of a graph found together, so that vertices and their neighbors are read
+//	once for all of them instead of once for each statistic.
+// All connected vertices are read into arrays (SlotLists.h) in one scan; degrees, the degree
+//	correlation and components (Graph::find_component_labels) are found from them in
+//	parallel loops, and triangles are counted from the same arrays for bidirectional graphs
+//	(TriangleCounter.h; outward ones are read again for digraphs). Only the mean distance
+//	reads the graph on its own (Graph::find_mean_distance).
+// Degrees here are numbers of neighbors (multilinks and loops ignored, both directions for
+//	digraphs), and the degree correlation is over pairs of neighbors.
+class NetworkStats {
+   public :
+	// Statistics that can be requested (combined with |).
+	enum Metric {
+		DEGREES=1,		// Degree distribution, maximum and mean degree.
+		DEGREE_CORRELATION=2,
+		CLUSTERING=4,		// Clustering coefficients and the number of triangles.
+		COMPONENTS=8,		// Number of components and the largest size.
+		MEAN_DISTANCE=16,
+		ALL=31
+	};
+
+	// Constructor (percent_sample: sources used for the mean distance).
+	NetworkStats(int m=ALL, double p=100.0) : metrics(m), percent_sample(p), nvertices(0), \
+		nedges(0), max_degree(0), mean_degree(0), degree_correlation(0), clustering_coeff(0), \
+		global_coeff(0), ntriangles(0), ncomponents(0), giant_size(0), mean_distance(0), \
+		degrees(), k_stat(), labels() {};
+
+	// Find the requested statistics of a graph (replacing the ones found before).
+	void find(const Graph &gr);
+
+	// Write the requested statistics as lines of "name<tab>value".
+	void write(Output &out) const;
+
+	// Get the statistics found.
+	int get_metrics() const {return metrics;};
+	long get_nvertices() const {return nvertices;};
+	long get_nedges() const {return nedges;};
+	long get_max_degree() const {return max_degree;};
+	double get_mean_degree() const {return mean_degree;};
+	double get_degree_correlation() const {return degree_correlation;};
+	double get_clustering_coeff() const {return clustering_coeff;};	// Averaged over vertices.
+	double get_global_coeff() const {return global_coeff;};
+	long get_ntriangles() const {return ntriangles;};
+	long get_ncomponents() const {return ncomponents;};
+	long get_giant_size() const {return giant_size;};
+	double get_mean_distance() const {return mean_distance;};
+	// Degree of each slot.
+	const std::vector<long> & get_degrees() const {return degrees;};
+	// Number of vertices for each degree (from 0 to the maximum degree).
+	const std::vector<long> & get_degree_stat() const {return k_stat;};
+	// Component of each slot (-1 for slots not used; Graph::find_component_labels).
+	const std::vector<long> & get_labels() const {return labels;};
+
+   private:
+	int metrics;		// Statistics requested.
+	double percent_sample;
+
+	long nvertices;
+	long nedges;
+	long max_degree;
+	double mean_degree;
+	double degree_correlation;
+	double clustering_coeff;
+	double global_coeff;
+	long ntriangles;
+	long ncomponents;
+	long giant_size;
+	double mean_distance;
+	std::vector<long> degrees;
+	std::vector<long> k_stat;
+	std::vector<long> labels;
+};
+
+}; // End of namespace conet.
+#endif
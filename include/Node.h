@@ -134,12 +134,14 @@ template<class State> class NodeF {
 // If the given type has a state, the state class should be defined, and this should be instantiated with State class.
 // For State class, default constructor should be given, operator= should be overloaded, 
 //	and print() function is assumed to exist (operator less than can be handy, too).
-template<class State> class NodeV {
+// Seq is the class for the time sequence: TimeSeq<State> (default), or TimeSeqFixed<State,N>
+//	when max_delay is known at compile time (no allocation, and no division when indexing).
+template<class State, class Seq=TimeSeq<State> > class NodeV {
    public:
    	// Constructor.
 	NodeV(): states(NodeV::get_default_size(),State(),0) {};
 	NodeV(TimeType ss, const State &val, TimeType ft=0): states(ss,val,ft) {};
-	NodeV(const NodeV<State> &node): states(NodeV::get_default_size(),State(),node.get_first_time()) {
+	NodeV(const NodeV &node): states(node.get_size(),State(),node.get_first_time()) {
 		for (TimeType t=get_first_time();t<=get_last_time();t++)
 			states.add_value(t,node.access_state_T(t));
 	};
@@ -148,18 +150,23 @@ template<class State> class NodeV {
 	~NodeV() {};
 
 	// copy the object.
-	void copy(const NodeV<State> &node) {
+	void copy(const NodeV &node) {
 		reset(node.get_size(),node.get_first_time());
 		for (TimeType t=get_first_time();t<=get_last_time();t++)
 			states.add_value(t,node.access_state_T(t));
 	};
 
+	// Exchange states with another node (used instead of assignment of a temporary).
+	void swap(NodeV &node) {
+		states.swap(node.states);
+	};
+
 	// Get the state
 	State get_state() const {
 		return states.get_last_value(); // Not well-defined (do not use it).
 	};
 	State get_state_T(TimeType t) const {
-		if (states.range(t)) return states(t);
+		if (states.range(t)) return states.access(t);
 	};
 
 	// Access the state
@@ -167,7 +174,7 @@ template<class State> class NodeV {
 		return states.get_last_value(); // Not well-defined (do not use it).
 	};
 	State & access_state_T(TimeType t) const {
-		if (states.range(t)) return states(t);
+		if (states.range(t)) return states.access(t);
 	};
 
 	// Set the state
@@ -184,7 +191,7 @@ template<class State> class NodeV {
 	};
 	bool read_state_T(std::istream &iif, TimeType t) const {
 		if (states.range(t)) return iif >> states(t);
-		else false;
+		else return false;
 	};
 
 	// Write the node info.
@@ -230,6 +237,36 @@ template<class State> class NodeV {
 		states.advance_without_change();
 	}; 
 
+	// Advance time lazily up to the time t, when the state has not changed since the time tw
+	//	(states at tw+1,...,t become the same as the state at tw).
+	//	At most get_size() states are copied however far t is.
+	void advance_from(TimeType tw, TimeType t) {
+		if (t<=tw) return;
+		State st=states(tw);
+		for (TimeType u=tw+1;u<=t && u<=get_last_time();u++) states.access(u)=st;
+		TimeType n=t-get_last_time();
+		if (n<=0) return;
+		if (n>get_size()) {
+			for (TimeType i=0;i<get_size();i++) states.advance_without_change();
+			states.set_first_time(t-get_size()+1); // All states are the same now.
+		}
+		else
+			for (TimeType i=0;i<n;i++) states.advance_without_change();
+	};
+
+	// Check if the time t is in the range of the sequence when it is advanced to the time now
+	//	(used with advance_from; the range is the same as when advanced at each step).
+	bool range_from(TimeType t, TimeType now) const {
+		TimeType last=(now>get_last_time())? now : get_last_time();
+		return (t<=last && t>last-get_size());
+	};
+
+	// Find the state at the time t, when the state has not changed since the time tw
+	//	(used with advance_from).
+	State & find_state_T(TimeType t, TimeType tw) const {
+		return states((t<tw)? t : tw);
+	};
+
 	// Show the NodeType.
 	static NodeType get_type() {
 		return type;
@@ -256,7 +293,7 @@ template<class State> class NodeV {
 	static DelayType default_size;
 
    protected:
-   	TimeSeq<State> states; // Time sequence of states for a given node. 
+   	Seq states; // Time sequence of states for a given node. 
 
 };
 
@@ -440,11 +477,11 @@ template<class State> class NodeVR: public NodeV<State>, public NodeR {
 };
 
 template<class State> NodeType NodeF<State>::type;
-template<class State> NodeType NodeV<State>::type;
+template<class State, class Seq> NodeType NodeV<State,Seq>::type;
 template<class State> NodeType NodeFR<State>::type;
 template<class State> NodeType NodeVR<State>::type;
 
-template<class State> DelayType NodeV<State>::default_size;
+template<class State, class Seq> DelayType NodeV<State,Seq>::default_size;
 template<class State> DelayType NodeVR<State>::default_size;
 
 }; // End of namespace conet.
@@ -27,10 +27,14 @@
 #include "TimeSeq.h"
 #include "Types.h"
 #include "Errors.h"
+#include "SlotMap.h"
+#include "IDAllocator.h"
 #include <istream>
 #include <ostream>
 #include <iostream>
 #include <map>
+#include <deque>
+#include <utility>
 
 namespace conet {
 
@@ -233,41 +237,38 @@ class NodesNF : public Nodes {
 class NodesNV: public Nodes {
    public:
    	// Constructor.
-   	NodesNV(TimeType &t, DelayType md=1): Nodes(t,md), nodes_id_type(),\
-		to_be_removed(), to_be_removed_at_time(), max_ID(-1), current_greatest_ID(-1) {};
-   	NodesNV(TimeType &t, const std::set<NodeType> &typeset, DelayType md=1): Nodes(t,typeset,md), nodes_id_type(),\
-		to_be_removed(), to_be_removed_at_time(), max_ID(-1), current_greatest_ID(-1) {};
+   	NodesNV(TimeType &t, DelayType md=1): Nodes(t,md), nodeinfos(), nremoved(0), to_be_removed_at_time(), ids(md) {};
+   	NodesNV(TimeType &t, const std::set<NodeType> &typeset, DelayType md=1): Nodes(t,typeset,md), nodeinfos(),\
+		nremoved(0), to_be_removed_at_time(), ids(md) {};
 
 	// Virtual destructor.
 	~NodesNV() {};
 	
 	// Get the number of nodes.
 	NodeID get_nnodes() const {
-		return nodes_id_type.size();
+		return nodeinfos.size()-nremoved;
 	};
 
 	// Get the NodeType of the given node. (should be redefined in the subclasses).
 	NodeType get_type(NodeID id) const {
-		if (this->if_ID(id)) {
-			std::map<NodeID,NodeType>::const_iterator i=nodes_id_type.find(id);
-			if (i!=nodes_id_type.end()) return i->second;
-		};
+		const NodeInfo *p=nodeinfos.find(id);
+		if (p && !p->removed) return p->type;
 		throw Bad_Node_ID();
 	};
 
    	// Find if the given ID already exists.
    	bool if_ID(NodeID id) const {
-		return (nodes_id_type.find(id)!=nodes_id_type.end());
+		const NodeInfo *p=nodeinfos.find(id);
+		return (p && !p->removed);
 	};
 
    	// Delete all nodes now.
 	void clear() {
 		Nodes::clear();
-		nodes_id_type.clear();
-		to_be_removed.clear();
+		nodeinfos.clear();
+		nremoved=0;
 		to_be_removed_at_time.clear();
-		max_ID=-1;
-		current_greatest_ID=-1;
+		ids.clear();
 	};
 	
 	// Advancing the time of all current node objects upto the given time.
@@ -281,13 +282,11 @@ class NodesNV: public Nodes {
 	// Adding a node.
 	bool add_node(NodeID id, NodeType nt, TimeType t) {
 		if (!if_type(nt)) throw Bad_Node_Type();
-		if (this->if_ID(id)) return false;
-		else {
-			nodes_id_type[id]=nt;
-			nodes_type_idset[nt].insert(id);
-			if (current_greatest_ID<id) current_greatest_ID=id;
-			return true;	
-		};
+		// The ID should not exist, and should not have been removed in the last max_delay steps.
+		if (!nodeinfos.if_free(id) || !ids.take(id,time)) return false;
+		nodeinfos.insert(id,NodeInfo(nt));
+		nodes_type_idset[nt].insert(id);
+		return true;	
 	};
 	bool add_node_generatedID(NodeID &id, NodeType nt, TimeType t) { // id represent a new ID
 		NodeID new_id=find_new_ID();
@@ -295,18 +294,32 @@ class NodesNV: public Nodes {
 			id=new_id;
 			return this->add_node(new_id,nt,t);
 		}
-		else	false;
+		else	return false;
+	};
+	// Adding n nodes with new IDs at once (returns the number of nodes added; IDs are stored in idv).
+	//	add_node is called for each ID, so subclasses store nodes as usual.
+	long add_nodes_generatedID(NodeIDVec &idv, long n, NodeType nt, TimeType t) {
+		if (!if_type(nt)) throw Bad_Node_Type();
+		this->delete_nodes(time);
+		ids.find_new(n,time,idv);
+		long nadded=0;
+		for (unsigned long i=0;i<idv.size();i++)
+			if (this->add_node(idv[i],nt,t)) idv[nadded++]=idv[i];
+		idv.resize(nadded);
+		return nadded;
 	};
 
 	// Removing a node with the given ID (the chosen node should be erased at (the current time) + max_delay
 	// At the current time, the given node will be listed in the set of nodes to be removed, and
 	//	later this node and its past information will be erased from here (using 'advance' memeber function).
 	bool remove_node(NodeID id, NodeType nt, TimeType t) {
-		if (if_ID_type(id,nt) && to_be_removed.find(id)==to_be_removed.end()) {
-			to_be_removed.insert(id);
-			to_be_removed_at_time[time+max_delay].insert(id);
-			nodes_id_type.erase(id);
+		NodeInfo *p=nodeinfos.find(id);
+		if (p && !p->removed && p->type==nt) {
+			p->removed=true;
+			nremoved++;
+			to_be_removed_at_time.push_back(std::make_pair(time+max_delay,id));
 			nodes_type_idset[nt].erase(id);
+			ids.release(id,time); // It can be reused after max_delay.
 			return true;
 		}
 		else return false;
@@ -316,53 +329,55 @@ class NodesNV: public Nodes {
 	// Delete given nodes now ("delete" means wiping all data about this node from here).
 	//	While "remove" means nodes disappear from the network at the given time,
 	//	keep in mind that the past states of nodes can be used even after given nodes has been removed.
+	// (Nodes are removed in the order of time, so they are deleted from the front of the queue.)
 	void delete_nodes(TimeType t) {
-		if (to_be_removed_at_time.find(t)!=to_be_removed_at_time.end()) return; // If there is no node to delete, return.
-		for (NodeIDSSet::iterator i=to_be_removed_at_time[t].begin();i!=to_be_removed_at_time[t].end();i++)
-			this->delete_node(*i);
-		to_be_removed_at_time.erase(t);
+		while (!to_be_removed_at_time.empty() && to_be_removed_at_time.front().first<=t) {
+			this->delete_node(to_be_removed_at_time.front().second);
+			to_be_removed_at_time.pop_front();
+		};
 	};
 	void delete_nodes_N(NodeType nt, TimeType t) {
-		if (to_be_removed_at_time.find(t)!=to_be_removed_at_time.end()) return; // If there is no node to delete, return.
-		for (NodeIDSSet::iterator i=to_be_removed_at_time[t].begin();i!=to_be_removed_at_time[t].end();i++)
-			if (this->get_type(*i)==nt) {
-				this->delete_node(*i);
-				to_be_removed_at_time[t].erase(i);
-			};
-		if (to_be_removed_at_time[t].size()==0) to_be_removed_at_time.erase(t); // If there is no node left to delete at time t, delete it.
+		std::deque<std::pair<TimeType,NodeID> > left;
+		while (!to_be_removed_at_time.empty() && to_be_removed_at_time.front().first<=t) {
+			NodeID id=to_be_removed_at_time.front().second;
+			if (nodeinfos.access(id).type==nt) this->delete_node(id);
+			else left.push_back(to_be_removed_at_time.front());
+			to_be_removed_at_time.pop_front();
+		};
+		to_be_removed_at_time.insert(to_be_removed_at_time.begin(),left.begin(),left.end());
 	};
 	virtual void delete_node(NodeID id) {
-		nodes_type_idset[nodes_id_type[id]].erase(id);
-		nodes_id_type.erase(id);
+		if (nodeinfos.erase(id)) nremoved--;
 	};
 
    	// Finding a new ID (new ID should not already exist).
+	// IDs of removed nodes are reused after max_delay (when they are deleted).
 	// Returns -1, if there is no available ID.
    	NodeID find_new_ID() {
-		// Before the current_greates_ID reaches the maximum value for the given NodeID type.
-		if (max_ID==-1) { // Maximum possible value hasn't been reached
-			if (++current_greatest_ID<0)  // Maximum possible value has been reached here.
-				max_ID=current_greatest_ID--; 	// Max_ID is set as the maximum possible value.
-			else return current_greatest_ID;
-		}
-		// After the max_ID has been reached, we have to find an unused ID.
-		//	(Expensive, it can be better.)
-		else 
-			for (NodeID id=0;id<=max_ID;id++)
-				if (!(this->if_ID(id))) return id; 
-		return -1;
+		this->delete_nodes(time); // Nodes whose IDs can be reused now are deleted first.
+		return ids.find_new(time);
 	};
 
+   public:
+	// Access the ID allocator (e.g. to change the window for reusing IDs).
+	IDAllocator & access_id_allocator() {
+		return ids;
+	};
 
    protected:
-	std::map<NodeID,NodeType> nodes_id_type;	// map of NodeID and NodeType. (use only when there are many types)
-
-	NodeIDSSet to_be_removed;			// Set of nodes to be removed (after max_delay).
-	std::map<TimeType,NodeIDSSet> to_be_removed_at_time;	// Set of nodes to be removed at given times in the future.
 
-	NodeID max_ID;	// maximum value for the NodeID type.
-	NodeID current_greatest_ID;	// current greatest ID.
+	// Information of a node.
+	struct NodeInfo {
+		NodeInfo(NodeType nt=0) : type(nt), removed(false) {};
+		NodeType type;
+		bool removed; // Removed, but not deleted yet (past states can be used).
+	};
 
+   protected:
+	SlotMap<NodeInfo> nodeinfos;	// Nodes with their ID's (including removed ones not deleted yet).
+	NodeID nremoved;		// Number of nodes removed, but not deleted yet.
+	std::deque<std::pair<TimeType,NodeID> > to_be_removed_at_time; // Nodes to be deleted at given times in the future.
+	IDAllocator ids;		// IDs of nodes.
 };
 
 // Template class that represents fixed number of nodes with one Node state involved.
@@ -509,7 +524,7 @@ template<class State> class NodesNV1S: public NodesNV {
 			id=new_id;
 			return this->add_node_S(new_id,nt,t,s);
 		}
-		else	false;
+		else	return false;
 	};
 
 	// Get the state of the given node.
@@ -569,7 +584,7 @@ template<class State1, class State2> class NodesNV2S: public NodesNV1S<State1> {
 			id=new_id;
 			return this->add_node_S2(new_id,nt,t,s);
 		}
-		else	false;
+		else	return false;
 	};
 
 	// Get the state of the given node.
@@ -610,16 +625,17 @@ class NodesNV_R: public NodesNV {
 	// Add a node 
 	bool add_node(NodeID id, NodeType nt, TimeType t) {
 		if (NodesNV::add_node(id,nt,t)) {
-			nodeset.insert(std::map<NodeID,NodeR>::value_type(id,NodeR()));
-			return true;
+			return nodeset.insert(id,NodeR()); // Keys are the same as in nodeinfos.
 		}
 		else return false;
 	};
 
 	// Get the RNG of the given node (if the node has RNG, i.e. derived from NodeR).
 	RNG_Limit &access_rng(NodeID id, NodeType nt) {
-		if (if_type(nt)) return nodeset[id].access_rng();
-		else throw Bad_Node_Type();
+		if (!if_type(nt)) throw Bad_Node_Type();
+		NodeR *p=nodeset.find(id);
+		if (p) return p->access_rng();
+		else throw Bad_Node_ID();
 	};
 
 	void write_T(std::ostream &of, TimeType t) const {};
@@ -633,15 +649,24 @@ class NodesNV_R: public NodesNV {
 	};
 
    protected:
-	std::map<NodeID,NodeR> nodeset;
+	SlotMap<NodeR> nodeset;
 };
 
+// Lazy mode of NodesNF_VR and NodesNF_V (set_lazy_mode):
+//	advance does nothing, and each node records the last time its state was set (or accessed by
+//	access_state); states after that time are the same as the state at that time (get_state finds
+//	them without copying), and they are copied only when the node is set.
+//	Useful when most nodes do not change (e.g. near convergence).
+//	Times are checked as if nodes were advanced at each step, so the same errors are thrown in both modes.
+//	(It should be turned on after the nodes are advanced to the current time, and when it is
+//	turned off, all nodes are advanced to the current time.)
+
 // Example2:
 // Nodes that have only one type with the varying state (NodeVR<State>) with the fixed number (state, with RNG)
 template<class State> class NodesNF_VR: public NodesNF1S<State> {
    public:
    	// Constructor.
-   	NodesNF_VR(TimeType &t, NodeID nnodes=0, DelayType md=1, NodeType nt=0): NodesNF1S<State>(t,md,nt), nodeset() {
+   	NodesNF_VR(TimeType &t, NodeID nnodes=0, DelayType md=1, NodeType nt=0): NodesNF1S<State>(t,md,nt), nodeset(), lazy(false), written() {
 		for (NodeID id=0;id<nnodes;id++) add_node(id,nt,NodesNF1S<State>::time);
 	};
 
@@ -652,11 +677,13 @@ template<class State> class NodesNF_VR: public NodesNF1S<State> {
 	void clear() {
 		NodesNF::clear();
 		nodeset.clear();
+		written.clear();
 	};
 	
 	// Advancing the time of all current node objects upto the reference time (if needed).
+	//	(In the lazy mode, nothing is done here; see set_lazy_mode.)
 	void advance(TimeType t) {
-		if (t<NodesNF1S<State>::time) return;
+		if (t<NodesNF1S<State>::time || lazy) return;
 		for (NodeID id=0;id<nodeset.size();id++) {
 			if (nodeset[id].get_last_time()<t) { // outside the range of the time sequence
 				while (nodeset[id].get_last_time()<t)
@@ -673,11 +700,29 @@ template<class State> class NodesNF_VR: public NodesNF1S<State> {
 		if (this->get_type_S()==nt) this->advance(t);
 	};
 
+	// Set the lazy mode (see the note on the lazy mode above).
+	void set_lazy_mode(bool lm) {
+		TimeType now=NodesNF1S<State>::time;
+		if (lm && !lazy)
+			written.assign(nodeset.size(),now);
+		else if (lazy && !lm)
+			for (NodeID id=0;id<nodeset.size();id++)
+				nodeset[id].advance_from(written[id],now);
+		lazy=lm;
+	};
+
+	// Check if the lazy mode is on.
+	bool if_lazy_mode() const {
+		return lazy;
+	};
+
 	// Add a node (RNG seed has to be set separately, too)
 	bool add_node_S(NodeID id, NodeType nt, TimeType t, const State &s) {
 		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
 		if (NodesNF::add_node(id,nt,t)) {
 			nodeset.resize(NodesNF1S<State>::get_nnodes());
+			written.resize(nodeset.size(),t);
+			written[id]=t;
 			nodeset[id]=NodeVR<State>(NodesNF1S<State>::max_delay+1,s,t);
 			return true;
 		}
@@ -687,6 +732,10 @@ template<class State> class NodesNF_VR: public NodesNF1S<State> {
 	// Get the state of the given node.
 	State get_state(NodeID id, NodeType nt, TimeType t) const {
 		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
+		if (lazy && NodesNF1S<State>::if_ID(id)) {
+			if (nodeset[id].range_from(t,NodesNF1S<State>::time)) return nodeset[id].find_state_T(t,written[id]);
+			else throw Bad_Node_ID();
+		};
 		if (NodesNF1S<State>::if_ID(id) && nodeset[id].range(t)) return nodeset[id].get_state_T(t);
 		else throw Bad_Node_ID();
 	};
@@ -695,6 +744,11 @@ template<class State> class NodesNF_VR: public NodesNF1S<State> {
 	State & access_state(NodeID id, NodeType nt, TimeType t) {
 		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
 		if (!NodesNF1S<State>::if_ID(id)) throw Bad_Node_ID();
+		if (lazy && !nodeset[id].range_from(t,NodesNF1S<State>::time)) throw TimeSeq_Range_Error();
+		if (lazy && t>written[id]) { // The reference can be used to change the state at t.
+			nodeset[id].advance_from(written[id],t);
+			written[id]=t;
+		};
 		if (nodeset[id].range(t)) return nodeset[id].access_state_T(t);
 		else throw TimeSeq_Range_Error();
 	};
@@ -703,6 +757,17 @@ template<class State> class NodesNF_VR: public NodesNF1S<State> {
 	bool set_state(NodeID id, NodeType nt, TimeType t, const State &s) {
 		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
 		if (NodesNF1S<State>::if_ID(id)) {
+			if (lazy && !nodeset[id].range_from(t,NodesNF1S<State>::time)) {
+				// Same as set_state_T: an error before the range, ignored after the next step.
+				if (!nodeset[id].range_from(t-1,NodesNF1S<State>::time)) {
+					if (t<=NodesNF1S<State>::time) throw TimeSeq_Range_Error();
+					return true;
+				};
+			};
+			if (lazy && t>written[id]) {
+				nodeset[id].advance_from(written[id],t-1);
+				written[id]=t;
+			};
 			nodeset[id].set_state_T(s,t);
 			return true;
 		}
@@ -717,7 +782,11 @@ template<class State> class NodesNF_VR: public NodesNF1S<State> {
 		};
 	};
 	void write_ID_T(std::ostream &of, NodeID id, TimeType t) const {
-		if (NodesNF1S<State>::if_ID(id) && nodeset[id].range(t)) of << nodeset[id].access_state_T(t);
+		if (!NodesNF1S<State>::if_ID(id)) return;
+		if (lazy) {
+			if (nodeset[id].range_from(t,NodesNF1S<State>::time)) of << nodeset[id].find_state_T(t,written[id]);
+		}
+		else if (nodeset[id].range(t)) of << nodeset[id].access_state_T(t);
 	};
 
 	// Get the RNG of the given node (if the node has RNG, i.e. derived from NodeR).
@@ -728,14 +797,17 @@ template<class State> class NodesNF_VR: public NodesNF1S<State> {
 
    protected:
 	std::vector<NodeVR<State> > nodeset;
+	bool lazy; // Lazy mode (see set_lazy_mode).
+	std::vector<TimeType> written; // Last time the state of each node was set (for the lazy mode).
 };
 
 // Example3:
 // Nodes that have only one type with the varying state (NodeV<State>) with the fixed number (state, without RNG)
-template<class State> class NodesNF_V: public NodesNF1S<State> {
+//	(Seq: class for the time sequence of each node, see NodeV; e.g. TimeSeqFixed<State,2> when max_delay=1.)
+template<class State, class Seq=TimeSeq<State> > class NodesNF_V: public NodesNF1S<State> {
    public:
    	// Constructor.
-   	NodesNF_V(TimeType &t, NodeID nnodes=0, DelayType md=1, NodeType nt=0): NodesNF1S<State>(t,md,nt), nodeset() {
+   	NodesNF_V(TimeType &t, NodeID nnodes=0, DelayType md=1, NodeType nt=0): NodesNF1S<State>(t,md,nt), nodeset(), lazy(false), written() {
 		for (NodeID id=0;id<nnodes;id++) add_node(id,nt,NodesNF1S<State>::time);
 	};
 
@@ -746,11 +818,13 @@ template<class State> class NodesNF_V: public NodesNF1S<State> {
 	void clear() {
 		NodesNF::clear();
 		nodeset.clear();
+		written.clear();
 	};
 	
 	// Advancing the time of all current node objects upto the given time without change (if needed).
+	//	(In the lazy mode, nothing is done here; see set_lazy_mode.)
 	void advance(TimeType t) {
-		if (t<NodesNF1S<State>::time) return;
+		if (t<NodesNF1S<State>::time || lazy) return;
 		for (NodeID id=0;id<nodeset.size();id++) {
 			if (nodeset[id].get_last_time()<t) { // outside the range of the time sequence
 				while (nodeset[id].get_last_time()<t)
@@ -767,12 +841,31 @@ template<class State> class NodesNF_V: public NodesNF1S<State> {
 		if (this->get_type_S()==nt) this->advance(t);
 	};
 
+	// Set the lazy mode (see the note on the lazy mode above).
+	void set_lazy_mode(bool lm) {
+		TimeType now=NodesNF1S<State>::time;
+		if (lm && !lazy)
+			written.assign(nodeset.size(),now);
+		else if (lazy && !lm)
+			for (NodeID id=0;id<nodeset.size();id++)
+				nodeset[id].advance_from(written[id],now);
+		lazy=lm;
+	};
+
+	// Check if the lazy mode is on.
+	bool if_lazy_mode() const {
+		return lazy;
+	};
+
 	// Add a node 
 	bool add_node_S(NodeID id, NodeType nt, TimeType t, const State &s) {
 		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
 		if (NodesNF::add_node(id,nt,t)) {
 			nodeset.resize(NodesNF1S<State>::get_nnodes());
-			nodeset[id]=NodeV<State>(NodesNF1S<State>::max_delay+1,s,t);
+			written.resize(nodeset.size(),t);
+			written[id]=t;
+			NodeV<State,Seq> node(NodesNF1S<State>::max_delay+1,s,t);
+			nodeset[id].swap(node);
 			return true;
 		}
 		else return false;
@@ -781,6 +874,10 @@ template<class State> class NodesNF_V: public NodesNF1S<State> {
 	// Get the state of the given node.
 	State get_state(NodeID id, NodeType nt, TimeType t) const {
 		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
+		if (lazy && NodesNF1S<State>::if_ID(id)) {
+			if (nodeset[id].range_from(t,NodesNF1S<State>::time)) return nodeset[id].find_state_T(t,written[id]);
+			else throw Bad_Node_ID();
+		};
 		if (NodesNF1S<State>::if_ID(id) && nodeset[id].range(t)) return nodeset[id].get_state_T(t);
 		else throw Bad_Node_ID();
 	};
@@ -789,6 +886,11 @@ template<class State> class NodesNF_V: public NodesNF1S<State> {
 	State & access_state(NodeID id, NodeType nt, TimeType t) {
 		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
 		if (!NodesNF1S<State>::if_ID(id)) throw Bad_Node_ID();
+		if (lazy && !nodeset[id].range_from(t,NodesNF1S<State>::time)) throw TimeSeq_Range_Error();
+		if (lazy && t>written[id]) { // The reference can be used to change the state at t.
+			nodeset[id].advance_from(written[id],t);
+			written[id]=t;
+		};
 		if (nodeset[id].range(t)) return nodeset[id].access_state_T(t);
 		else throw TimeSeq_Range_Error();
 	};
@@ -797,6 +899,17 @@ template<class State> class NodesNF_V: public NodesNF1S<State> {
 	bool set_state(NodeID id, NodeType nt, TimeType t, const State &s) {
 		if (nt!=NodesNF1S<State>::get_type_S()) return false;
 		if (NodesNF1S<State>::if_ID(id)) {
+			if (lazy && !nodeset[id].range_from(t,NodesNF1S<State>::time)) {
+				// Same as set_state_T: an error before the range, ignored after the next step.
+				if (!nodeset[id].range_from(t-1,NodesNF1S<State>::time)) {
+					if (t<=NodesNF1S<State>::time) throw TimeSeq_Range_Error();
+					return true;
+				};
+			};
+			if (lazy && t>written[id]) {
+				nodeset[id].advance_from(written[id],t-1);
+				written[id]=t;
+			};
 			nodeset[id].set_state_T(s,t);
 			return true;
 		}
@@ -811,7 +924,11 @@ template<class State> class NodesNF_V: public NodesNF1S<State> {
 		};
 	};
 	void write_ID_T(std::ostream &of, NodeID id, TimeType t) const {
-		if (NodesNF1S<State>::if_ID(id) && nodeset[id].range(t)) of << nodeset[id].access_state_T(t);
+		if (!NodesNF1S<State>::if_ID(id)) return;
+		if (lazy) {
+			if (nodeset[id].range_from(t,NodesNF1S<State>::time)) of << nodeset[id].find_state_T(t,written[id]);
+		}
+		else if (nodeset[id].range(t)) of << nodeset[id].access_state_T(t);
 	};
 
 	// Get the RNG of the given node (if the node has RNG, i.e. derived from NodeR).
@@ -820,7 +937,182 @@ template<class State> class NodesNF_V: public NodesNF1S<State> {
 	};
 
    protected:
-	std::vector<NodeV<State> > nodeset;
+	std::vector<NodeV<State,Seq> > nodeset;
+	bool lazy; // Lazy mode (see set_lazy_mode).
+	std::vector<TimeType> written; // Last time the state of each node was set (for the lazy mode).
+};
+
+// Example4:
+// Nodes that have only one type with the varying state with the fixed number (state, without RNG),
+//	stored as arrays: states of all nodes at a time are in one array indexed by NodeID, and
+//	arrays for max_delay+1 times are used as a ring, so there is no allocation for each node,
+//	and states of neighbors at a time are read from one contiguous array (access_states_T).
+// All nodes share the same range of times. It moves by one when a state is set at the next time
+//	(states at that time are copied from the previous time first, as in NodeV), or by advance;
+//	the array of the earliest time is reused, so no array is allocated after nodes are added.
+// Moving the range copies the states of all nodes (O(N) for N nodes at each step), so this is
+//	meant for models where most nodes are updated at each step; when only a few nodes change,
+//	NodesNF_V in the lazy mode (set_lazy_mode) is faster.
+template<class State> class NodesNF_VA: public NodesNF1S<State> {
+   public:
+   	// Constructor.
+   	NodesNF_VA(TimeType &t, NodeID nnodes=0, DelayType md=1, NodeType nt=0): NodesNF1S<State>(t,md,nt), \
+		states(md+1), first_time(t), first_index(0) {
+		for (NodeID id=0;id<nnodes;id++) this->add_node(id,nt,NodesNF1S<State>::time);
+	};
+
+	// Virtual destructor.
+	~NodesNF_VA() {};
+	
+   	// Delete all nodes now.
+	void clear() {
+		NodesNF::clear();
+		for (unsigned long i=0;i<states.size();i++)
+			states[i].clear();
+	};
+	
+	// Get the range of times stored.
+	TimeType get_first_time() const {
+		return first_time;
+	};
+	TimeType get_last_time() const {
+		return first_time+states.size()-1;
+	};
+	bool range(TimeType t) const {
+		return (t>=first_time && t<=get_last_time());
+	};
+
+	// Advancing the time of all current node objects upto the given time without change (if needed).
+	void advance(TimeType t) {
+		if (t<NodesNF1S<State>::time) return;
+		if (get_last_time()<t) { // outside the range of times
+			while (get_last_time()<t)
+				this->rotate();
+		}
+		else if (range(t-1))	// Assumes that time advances with 1 (the state is kept).
+			states[this->get_index(t)]=states[this->get_index(t-1)];
+	};
+	void advance_N(NodeType nt, TimeType t) {
+		if (this->get_type_S()==nt) this->advance(t);
+	};
+
+	// Add a node 
+	bool add_node_S(NodeID id, NodeType nt, TimeType t, const State &s) {
+		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
+		if (NodesNF::add_node(id,nt,t)) {
+			if (NodesNF1S<State>::get_nnodes()==1) { // The range of times starts with the first node.
+				first_time=t;
+				first_index=0;
+			};
+			for (unsigned long i=0;i<states.size();i++)
+				states[i].push_back(s);
+			return true;
+		}
+		else return false;
+	};
+
+	// Get the state of the given node.
+	State get_state(NodeID id, NodeType nt, TimeType t) const {
+		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
+		if (NodesNF1S<State>::if_ID(id) && range(t)) return states[this->get_index(t)][id];
+		else throw Bad_Node_ID();
+	};
+
+	// Access the state of the given node.
+	State & access_state(NodeID id, NodeType nt, TimeType t) {
+		if (nt!=NodesNF1S<State>::get_type_S()) throw Wrong_Node_Type();
+		if (!NodesNF1S<State>::if_ID(id)) throw Bad_Node_ID();
+		if (range(t)) return states[this->get_index(t)][id];
+		else throw TimeSeq_Range_Error();
+	};
+
+	// Access the states of all nodes at the given time (indexed by NodeID).
+	const std::vector<State> & access_states_T(TimeType t) const {
+		if (range(t)) return states[this->get_index(t)];
+		else throw TimeSeq_Range_Error();
+	};
+
+	// Set the Node state of the given node.
+	// (When t=get_last_time()+1, the range of times moves to the next step first.)
+	bool set_state(NodeID id, NodeType nt, TimeType t, const State &s) {
+		if (nt!=NodesNF1S<State>::get_type_S()) return false;
+		if (!NodesNF1S<State>::if_ID(id)) return false;
+		if (t<first_time) throw TimeSeq_Range_Error();
+		if (t==get_last_time()+1) this->rotate();
+		if (t<=get_last_time()) states[this->get_index(t)][id]=s;
+		return true;
+	};
+
+	// Write the nodes info.
+	void write_T(std::ostream &of, TimeType t) const {
+		for (NodeID id=0;id<NodesNF1S<State>::get_nnodes();id++) {
+			write_ID_T(of,id,t);
+			of << '\n';
+		};
+	};
+	void write_ID_T(std::ostream &of, NodeID id, TimeType t) const {
+		if (NodesNF1S<State>::if_ID(id) && range(t)) of << states[this->get_index(t)][id];
+	};
+
+	// Get the RNG of the given node (no RNG here).
+	RNG_Limit & access_rng(NodeID id, NodeType nt) {
+		throw Bad_Node_Type();
+	};
+
+   protected:
+	// Find the index of the array for a given time (in range).
+	long get_index(TimeType t) const {
+		return (first_index+t-first_time)%states.size();
+	};
+
+	// Move the range of times by one: the array of the earliest time is used for the next
+	//	time, with states copied from the last time (memory is reused; O(N) for N nodes).
+	void rotate() {
+		states[first_index]=states[this->get_index(this->get_last_time())];
+		first_index=(first_index+1)%states.size();
+		first_time++;
+	};
+
+	std::vector<std::vector<State> > states;	// States of all nodes for max_delay+1 times (ring).
+	TimeType first_time;	// Earliest time stored.
+	long first_index;	// Index of the array for first_time.
+};
+
+// Example5:
+// Same as Example4 with RNG for each node (NodesNF_VR stored as arrays).
+template<class State> class NodesNF_VRA: public NodesNF_VA<State> {
+   public:
+   	// Constructor.
+   	NodesNF_VRA(TimeType &t, NodeID nnodes=0, DelayType md=1, NodeType nt=0): NodesNF_VA<State>(t,0,md,nt), rngs() {
+		for (NodeID id=0;id<nnodes;id++) this->add_node(id,nt,NodesNF1S<State>::time);
+	};
+
+	// Virtual destructor.
+	~NodesNF_VRA() {};
+	
+   	// Delete all nodes now.
+	void clear() {
+		NodesNF_VA<State>::clear();
+		rngs.clear();
+	};
+
+	// Add a node (RNG seed has to be set separately, too)
+	bool add_node_S(NodeID id, NodeType nt, TimeType t, const State &s) {
+		if (NodesNF_VA<State>::add_node_S(id,nt,t,s)) {
+			rngs.push_back(RNG_Limit(1));
+			return true;
+		}
+		else return false;
+	};
+
+	// Get the RNG of the given node.
+	RNG_Limit & access_rng(NodeID id, NodeType nt) {
+		if (NodesNF1S<State>::if_type(nt)) return rngs[id];
+		else throw Bad_Node_Type();
+	};
+
+   protected:
+	std::vector<RNG_Limit> rngs;	// RNG of each node.
 };
 
 }; // End of namespace conet.
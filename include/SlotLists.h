@@ -0,0 +1,73 @@
+//
+//	CONETSIM - SlotLists.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef SLOTLISTS_H
+#define SLOTLISTS_H
+
+#include "Graph.h"
+#include "Types.h"
+#include <vector>
+
+namespace conet {
+
+// Lists of connected vertices of a graph as arrays of slots (Graph::find_slot), read once
+//	so that algorithms reading them many times (or from many threads) don't call
+//	virtual functions of the graph for each vertex.
+// If the graph stores the lists in arrays (Graph::access_out_deps), those arrays are used
+//	directly; otherwise they are copied (multilinks and loops ignored).
+// The graph should not be changed while this object is used.
+class SlotLists {
+   public :
+	// Constructor (out=true: outward connected vertices, false: all connected vertices,
+	//	which are different only for digraphs).
+	SlotLists(const Graph &gr, bool out=true);
+
+	// Get the number of slots.
+	long get_slot_size() const {
+		return first.size();
+	};
+
+	// Range [begin(s),end(s)) of connected slots of a slot.
+	const NodeID * begin(long s) const {
+		return first[s];
+	};
+	const NodeID * end(long s) const {
+		return last[s];
+	};
+
+	// Get the number of connected slots of a slot.
+	long size(long s) const {
+		return last[s]-first[s];
+	};
+
+   private:
+	// Not copied (pointers may point to adj).
+	SlotLists(const SlotLists &);
+	SlotLists & operator=(const SlotLists &);
+
+	std::vector<const NodeID *> first;	// Connected slots of each slot,
+	std::vector<const NodeID *> last;	//	from first[s] to last[s]-1.
+	std::vector<NodeID> adj;		// Copied slots (empty when arrays of the graph are used).
+};
+
+}; // End of namespace conet.
+#endif
@@ -0,0 +1,256 @@
+//
+//	CONETSIM - SlotMap.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef SLOTMAP_H
+#define SLOTMAP_H
+
+#include <vector>
+#include <climits>
+#include "HashIndex.h"
+
+namespace conet {
+
+// Container of values with stable IDs (keys), used for nodes and links whose number varies.
+// Values are stored densely in one array (iterated with begin() and end(), in no particular order),
+//	and a key is made of a slot index (lower INDEX_BITS bits) and a generation (upper bits).
+// Each slot knows the position of its value, so finding, inserting and erasing are O(1)
+//	(the last value is moved to the hole when a value is erased).
+// When a value is erased, the generation of its slot increases and the slot goes to the free list,
+//	so a new key (next_key, insert(value)) reuses the slot, but the old key stays invalid.
+// Keys can be also given (insert(key,value)), e.g. IDs given by users (any non-negative ID).
+//	A given key uses its slot only when the slot is free with the same generation (e.g. a key from
+//	next_key), or when it is a new slot not far beyond the used slots; other keys (e.g. IDs equal to
+//	or larger than 2^INDEX_BITS, or IDs whose slots have newer generations) are kept in a hash table,
+//	so generations of slots are never changed by given keys, and keys from next_key skip given keys.
+// (T should have operator=.)
+template<class T> class SlotMap {
+   public :
+	typedef long Key;
+
+	// Number of bits for the slot index.
+	static const int INDEX_BITS=(sizeof(long)>4)? 32 : 24;
+
+	// Constructor.
+	SlotMap() : values(), keys(), slots(), free_slots(), far() {};
+
+	// Get the number of values.
+	long size() const {
+		return values.size();
+	};
+
+	// Check if it is empty.
+	bool empty() const {
+		return values.empty();
+	};
+
+	// Remove all values (generations are forgotten, too).
+	void clear() {
+		values.clear();
+		keys.clear();
+		slots.clear();
+		free_slots.clear();
+		far.clear();
+	};
+
+	// Make sure there is a space for n values.
+	void reserve(long n) {
+		values.reserve(n);
+		keys.reserve(n);
+		slots.reserve(n);
+	};
+
+	// Check if the key exists.
+	bool if_key(Key k) const {
+		return (this->pos_of(k)>=0);
+	};
+
+	// Check if a value can be inserted with the key.
+	bool if_free(Key k) const {
+		return (k>=0 && this->pos_of(k)<0);
+	};
+
+	// Find the value for the key (returns 0 if the key doesn't exist).
+	T * find(Key k) {
+		long p=this->pos_of(k);
+		return (p>=0)? &values[p] : 0;
+	};
+	const T * find(Key k) const {
+		long p=this->pos_of(k);
+		return (p>=0)? &values[p] : 0;
+	};
+
+	// Access the value for the key (the key should exist; not checked).
+	T & access(Key k) {
+		return values[this->pos_of(k)];
+	};
+	const T & access(Key k) const {
+		return values[this->pos_of(k)];
+	};
+
+	// Find the key that will be used by insert(value) next time (-1 if no slot is available).
+	Key next_key() {
+		// Slots taken by given keys are removed from the free list here.
+		while (!free_slots.empty() && slots[free_slots.back()].pos>=0) free_slots.pop_back();
+		if (!free_slots.empty()) {
+			long s=free_slots.back();
+			// Generations used by given keys in the hash table are skipped.
+			while (far.size()>0 && far.find(make_key(s,slots[s].gen))>=0)
+				slots[s].gen=(slots[s].gen+1)&GEN_MASK;
+			return make_key(s,slots[s].gen);
+		};
+		// Given keys in the hash table are moved to slots when slots reach them.
+		while (far.size()>0 && far.find(slots.size())>=0) this->grow(slots.size()+1);
+		if (long(slots.size())>INDEX_MASK) return -1;
+		return slots.size();
+	};
+
+	// Insert a value with a new key (returns the key, or -1 if failed).
+	Key insert(const T &v) {
+		Key k=this->next_key();
+		if (k>=0) this->insert(k,v);
+		return k;
+	};
+
+	// Insert a value with the given key (returns false if the key is not free).
+	bool insert(Key k, const T &v) {
+		if (!this->if_free(k)) return false;
+		long s=slot_of(k);
+		if (s>=long(slots.size()) && gen_of(k)==0 && s<2*long(values.size())+FAR_SLOTS)
+			this->grow(s+1); // New slots (their generation is 0).
+		if (s<long(slots.size()) && slots[s].pos<0 && slots[s].gen==gen_of(k))
+			slots[s].pos=values.size();
+		else	far.insert(k,values.size());
+		values.push_back(v);
+		keys.push_back(k);
+		return true;
+	};
+
+	// Erase the value with the key (returns false if the key doesn't exist).
+	bool erase(Key k) {
+		long p=this->pos_of(k), last=values.size()-1;
+		if (p<0) return false;
+		bool in_slot=this->if_in_slot(k);
+		if (p<last) { // The last value is moved to p.
+			values[p]=values[last];
+			keys[p]=keys[last];
+			this->set_pos(keys[p],p);
+		};
+		values.pop_back();
+		keys.pop_back();
+		long s=slot_of(k);
+		if (in_slot) {
+			slots[s].pos=-1;
+			slots[s].gen=(slots[s].gen+1)&GEN_MASK;
+			free_slots.push_back(s);
+		}
+		else	far.erase(k);
+		return true;
+	};
+
+	// Iterators for values (contiguous).
+	T * begin() {
+		return values.empty()? 0 : &values[0];
+	};
+	T * end() {
+		return this->begin()+values.size();
+	};
+	const T * begin() const {
+		return values.empty()? 0 : &values[0];
+	};
+	const T * end() const {
+		return this->begin()+values.size();
+	};
+
+	// Get the key of the i-th value (0<=i<size()).
+	Key get_key(long i) const {
+		return keys[i];
+	};
+
+	// Find all keys (not sorted).
+	const std::vector<Key> & access_keys() const {
+		return keys;
+	};
+
+   private:
+	static const long INDEX_MASK=(1L<<INDEX_BITS)-1;
+	static const long GEN_MASK=LONG_MAX>>INDEX_BITS; // Keys stay non-negative.
+	static const long FAR_SLOTS=64;	// Given keys beyond 2*size()+FAR_SLOTS don't make slots.
+
+	static long slot_of(Key k) {
+		return k&INDEX_MASK;
+	};
+	static long gen_of(Key k) {
+		return k>>INDEX_BITS;
+	};
+	static Key make_key(long s, long g) {
+		return (g<<INDEX_BITS)|s;
+	};
+
+	// Check if the key uses its slot.
+	bool if_in_slot(Key k) const {
+		unsigned long s=slot_of(k);
+		return (s<slots.size() && slots[s].pos>=0 && slots[s].gen==gen_of(k));
+	};
+
+	// Find the position of the value for the key (-1 if the key doesn't exist).
+	long pos_of(Key k) const {
+		if (k<0) return -1;
+		if (this->if_in_slot(k)) return slots[slot_of(k)].pos;
+		return (far.size()>0)? far.find(k) : -1;
+	};
+
+	// Set the position of the value for the key.
+	void set_pos(Key k, long p) {
+		if (this->if_in_slot(k)) slots[slot_of(k)].pos=p;
+		else	far.insert(k,p);
+	};
+
+	// Make slots up to n-1 (keys in the hash table are moved to their slots).
+	void grow(long n) {
+		long n0=slots.size();
+		slots.resize(n,Slot());
+		for (long i=n-1;i>=n0;i--) {
+			long p=(far.size()>0)? far.find(i) : -1;
+			if (p>=0) {
+				slots[i].pos=p;
+				far.erase(i);
+			}
+			else	free_slots.push_back(i);
+		};
+	};
+
+	// Slot (pos=-1 when free).
+	struct Slot {
+		Slot() : pos(-1), gen(0) {};
+		long pos;	// Position of the value.
+		long gen;	// Generation.
+	};
+
+	std::vector<T> values;		// Values (dense).
+	std::vector<Key> keys;		// Keys of values.
+	std::vector<Slot> slots;	// Slots for keys.
+	std::vector<long> free_slots;	// Free slots (slots taken later by given keys can be here, too).
+	HashIndex far;			// Positions for given keys not using their slots.
+};
+
+}; // End of namespace conet.
+#endif
@@ -29,6 +29,7 @@
 #include <iostream>
 #include <ostream>
 #include <vector>
+#include <algorithm>
 
 namespace conet {
 
@@ -183,15 +184,22 @@ template<class State> class TimeSeq {
 		return seq[get_index(t)];
 	};
 
-	// Assignment operator.
-	TimeSeq<State> & operator=(const TimeSeq<State> &r1) {
-  		size=r1.get_size();
-		delete [] seq;
-		first_index=0;
-		first_time=r1.get_first_time();
-		seq=new State [size];
-		for (long i=0;i<size;i++)
-	  		seq[i]=r1(first_time+i);
+	// Retrieve a value without the range check (t should be in the range).
+	State & access(TimeType t) const {
+		return seq[(first_index+t-first_time)%size];
+	};
+
+	// Exchange contents with another sequence (no copy of states).
+	void swap(TimeSeq<State> &r) {
+		std::swap(size,r.size);
+		std::swap(first_time,r.first_time);
+		std::swap(first_index,r.first_index);
+		std::swap(seq,r.seq);
+	};
+
+	// Assignment operator (copy and swap; a temporary on the right side is not copied twice).
+	TimeSeq<State> & operator=(TimeSeq<State> r1) {
+		this->swap(r1);
 		return *this;
 	};
 
@@ -228,16 +236,208 @@ template<class State> class TimeSeq {
 	State *seq;
 };
 
+// Smallest power of 2 not less than N (used for the capacity of TimeSeqFixed).
+template<long N, long P=1, bool Done=(P>=N)> struct CeilPow2 {
+	static const long value=CeilPow2<N,2*P>::value;
+};
+template<long N, long P> struct CeilPow2<N,P,true> {
+	static const long value=P;
+};
+
+// TimeSeq with the capacity fixed at compile time.
+//	States are stored inside the object (no allocation) in a ring of CAPACITY elements
+//	(N rounded up to a power of 2), so indexes are found by masking instead of division.
+//	The size of the sequence (max_delay+1 for nodes and links) can be set at run time
+//	up to CAPACITY; otherwise, TimeSeq_Capacity_Error is thrown.
+// It has the same interface as TimeSeq, so it can be used for NodeV and LinkV (and their
+//	containers) as the second template argument, e.g. NodeV<State,TimeSeqFixed<State,2> >.
+template<class State, long N> class TimeSeqFixed {
+   public:
+	static const long CAPACITY=CeilPow2<N>::value;
+	static const long MASK=CAPACITY-1;
+
+	// Constructors.
+	TimeSeqFixed(): size(N), first_time(0), first_index(0) {};
+	TimeSeqFixed(long s, const State &val, TimeType ft): size(s), first_time(ft), first_index(0) {
+		if (size>CAPACITY) throw TimeSeq_Capacity_Error();
+		for (long i=0;i<size;i++) seq[i]=val;
+	};
+
+	// Get functions.
+	long get_size() const {
+		return size;
+	};
+	TimeType get_first_time() const {
+		return first_time;
+	};
+	TimeType get_last_time() const {
+		return first_time+size-1;
+	};
+	long get_first_index() const {
+		return first_index;
+	};
+	State get_first_value() const {
+		return seq[first_index];
+	};
+	State get_last_value() const {
+		return seq[(first_index+size-1)&MASK];
+	};
+
+	// return the index when t is given
+	long get_index(TimeType t) const {
+		if (range(t))
+			return (first_index+t-first_time)&MASK;
+		else {
+			TimeSeq_Range_Error er;
+			throw er;
+		};
+	};
+
+	// Range check
+	bool range(TimeType t) const {
+		return (t>=first_time && t<first_time+size);
+	};
+
+	// Set the first_time (everything else is the same as before; can be used right after the default initialization).
+	void set_first_time(TimeType ft) {
+		first_time=ft;
+	};
+
+	// Reset the size with new size and the same first_time (can be used right after the default initialization).
+	void reset(long size1) {
+		this->reset(size1,first_time);
+	};
+	// Reset the size with new size and first_time.
+	void reset(long size1, TimeType first_time1) {
+		if (size1>CAPACITY) throw TimeSeq_Capacity_Error();
+		size=size1;
+		first_index=0;
+		first_time=first_time1;
+		for (long i=0;i<size;i++)
+	  		seq[i]=State();
+	};
+
+	// To add a value (same as TimeSeq::add_value)
+	// 	when t is in range, replace the existing value
+	// 	when t >= first_time+size, value is added at t (in-between values are assumed to be 0).
+	// 	when otherwise, an error is thrown.
+	void add_value(TimeType t, const State &val) {
+		if (t<first_time) {
+			TimeSeq_Range_Error er;
+			throw er;
+		}
+		else if (t<first_time+size)
+			seq[(first_index+t-first_time)&MASK]=val;
+		else if (t<first_time+2*size) {
+			while (first_time+size<t) this->advance_with_this_value(State());
+			this->advance_with_this_value(val);
+		}
+		else {
+			for (long i=0;i<size-1;i++) seq[i]=State();
+			first_index=0;
+			first_time=t-size+1;
+			seq[size-1]=val;
+		};
+	};
+	void replace_first(const State &val) {
+		seq[first_index]=val;
+	};
+
+	// Used when time progresses with the given value or without any change
+	void advance_with_this_value(const State &st) {
+		seq[(first_index+size)&MASK]=st;
+		first_time++;
+		first_index=(first_index+1)&MASK;
+	};
+	void advance_without_change() {
+		seq[(first_index+size)&MASK]=seq[(first_index+size-1)&MASK];
+		first_time++;
+		first_index=(first_index+1)&MASK;
+	};
+
+	// Easy way to retrieve a value using t.
+	// It returns the reference.
+	State & operator() (TimeType t) const {
+		return seq[get_index(t)];
+	};
+
+	// Retrieve a value without the range check (t should be in the range).
+	State & access(TimeType t) const {
+		return seq[(first_index+t-first_time)&MASK];
+	};
+
+	// Exchange contents with another sequence (states are swapped one by one,
+	//	so it is cheap when std::swap is cheap for State).
+	void swap(TimeSeqFixed<State,N> &r) {
+		for (long i=0;i<CAPACITY;i++) std::swap(seq[i],r.seq[i]);
+		std::swap(size,r.size);
+		std::swap(first_time,r.first_time);
+		std::swap(first_index,r.first_index);
+	};
+
+	// Print time and value pairs to stdout.
+	void print_first() const {
+		std::cout << "time:\t" << first_time << std::endl;
+		std::cout << seq[first_index] << std::endl;
+	};
+	void print_last() const {
+		std::cout << "time:\t" << first_time+size-1 << std::endl;
+		std::cout << this->access(first_time+size-1) << std::endl;
+	};
+	void print_all() const {
+		for (TimeType t=first_time;t<first_time+size;t++) {
+			std::cout << "time:\t" << t << std::endl;
+			std::cout << this->access(t) << std::endl;
+		};
+	};
+	void write(std::ostream &of) const {
+		of << first_time+size-1 << '\n';
+		of << this->access(first_time+size-1) << '\n';
+	};
+
+   private:
+	// size of the structure (not greater than CAPACITY)
+	long size;
+	// time value of the first element
+	TimeType first_time;
+	// index of the first element in the seq.
+	long first_index;
+	// data structure that contains the elements (mutable as in TimeSeq, where operator() returns a reference).
+	mutable State seq[CAPACITY];
+};
+
+template<class State, long N> const long TimeSeqFixed<State,N>::CAPACITY;
+template<class State, long N> const long TimeSeqFixed<State,N>::MASK;
+
+// Swap functions found by argument-dependent lookup.
+template<class State> inline void swap(TimeSeq<State> &a, TimeSeq<State> &b) {
+	a.swap(b);
+};
+template<class State, long N> inline void swap(TimeSeqFixed<State,N> &a, TimeSeqFixed<State,N> &b) {
+	a.swap(b);
+};
+
 // Time sequence for Graph classes.
+//
+// Delta mode (set_delta_mode(true)):
+//	Changes of edges made by add_link/remove_link functions are recorded for each time.
+//	When time advances without change, the graph of the oldest time (to be reused for the new time)
+//	is updated by applying the recorded changes of later times instead of copying the whole graph,
+//	so the cost is proportional to the number of changes, not the number of edges.
+//	(The whole graph is copied when the changes are not known, e.g. after add_value, advance_with_null,
+//	or changes made directly through access_graph, which are not recorded.)
 class TimeSeqGraphs {
    public:
 	// Constructors.
 	// Default with the sequence size 2 and Graph objects should be linked using assign_graphs function.
-	TimeSeqGraphs(): size(2), seq(2), first_time(0), first_index(0) {};
+	TimeSeqGraphs(): size(2), first_time(0), first_index(0), seq(2), \
+		delta_mode(false), deltas(2), if_known(2,false) {};
 	// Only the size of the time sequence is given, and Graph objects should be linked using assign_graphs function.
-	TimeSeqGraphs(long s, TimeType ft=0): size(s), seq(s), first_time(ft), first_index(0) {};
+	TimeSeqGraphs(long s, TimeType ft=0): size(s), first_time(ft), first_index(0), seq(s), \
+		delta_mode(false), deltas(s), if_known(s,false) {};
 	// Assuming pointers in s is already pointing appropriate Graph objects. 
-	TimeSeqGraphs(const std::vector<Graph *>  &s, TimeType ft=0): size(s.size()), seq(s), first_time(ft), first_index(0) {};
+	TimeSeqGraphs(const std::vector<Graph *>  &s, TimeType ft=0): size(s.size()), first_time(ft), first_index(0), seq(s), \
+		delta_mode(false), deltas(s.size()), if_known(s.size(),false) {};
 	
 	// Destructor
 	~TimeSeqGraphs() {};
@@ -246,9 +446,21 @@ class TimeSeqGraphs {
 	bool assign_graphs(const std::vector<Graph *> &grs) {
 		if (size!=grs.size()) return false;
 		seq=grs;
+		this->forget_changes();
 		return true;
 	};
 
+	// Set the delta mode (see above).
+	void set_delta_mode(bool dm) {
+		delta_mode=dm;
+		this->forget_changes();
+	};
+
+	// Check if the delta mode is on.
+	bool if_delta_mode() const {
+		return delta_mode;
+	};
+
 	// Get functions.
 	long get_size() const {
 		return size;
@@ -283,6 +495,9 @@ class TimeSeqGraphs {
 		first_index=0;
 		first_time=first_time1;
 		seq.resize(size);
+		deltas.resize(size);
+		if_known.resize(size);
+		this->forget_changes();
 	};
 
 	// return the index when t is given
@@ -306,6 +521,7 @@ class TimeSeqGraphs {
 	// 		if t is not first_time+size, in-between values are assumed to be the same as the given value.
 	// 	when otherwise, an error is thrown.
 	void add_value(TimeType t, const Graph &gr) {
+		this->forget_changes();
 		if (t<first_time) {
 			TimeSeq_Range_Error er;
 			throw er;
@@ -337,12 +553,16 @@ class TimeSeqGraphs {
 	
 	// Used when time progresses by one time step without any change
 	void advance_without_change() {
-		seq[first_index]->copy(*get_last_value());
+		if (!this->apply_changes()) seq[first_index]->copy(*get_last_value());
+		deltas[first_index].clear();
+		if_known[first_index]=delta_mode;
 		first_time++;
 		first_index=(first_index+1)%size;
 	};
 	void advance_with_null() {
 		seq[first_index]->clear_edges();
+		deltas[first_index].clear();
+		if_known[first_index]=false;
 		first_time++;
 		first_index=(first_index+1)%size;
 	};
@@ -361,23 +581,23 @@ class TimeSeqGraphs {
 	bool remove_link(TimeType t, NodeID ori, NodeID des) {
 		// If t is in the range, then simply remove the edge.
 		if (range(t)) {
-			return seq[get_index(t)]->remove_edge(ori,des);
+			return record(t,ori,des,-1,false,seq[get_index(t)]->remove_edge(ori,des));
 		}
 		// If t=last_time+1 and the edge exists, then advance time without change and remove the edge.
 		else if (t==get_last_time()+1 && get_last_value()->find_edge(ori,des)) {
 			advance_without_change();
-			return seq[get_index(t)]->remove_edge(ori,des);
+			return record(t,ori,des,-1,false,seq[get_index(t)]->remove_edge(ori,des));
 		}
 		else return false; // Don't do anything when t<first_time or t>last_time+1.
 	};
 	bool remove_link_ID(TimeType t, LinkID id, NodeID ori, NodeID des) {
 		// If t is in the range, then simply remove the edge.
 		if (range(t))
-			return seq[get_index(t)]->remove_edge_ID(ori,des,id);
+			return record(t,ori,des,id,false,seq[get_index(t)]->remove_edge_ID(ori,des,id));
 		// If t=last_time+1 and the edge exists, then advance time without change and remove the edge.
 		else if (t==get_last_time()+1) {
 			advance_without_change();
-			return seq[get_index(t)]->remove_edge_ID(ori,des,id);
+			return record(t,ori,des,id,false,seq[get_index(t)]->remove_edge_ID(ori,des,id));
 		}
 		else return false; // Don't do anything when t<first_time or t>last_time+1.
 	};
@@ -386,23 +606,23 @@ class TimeSeqGraphs {
 	bool add_link(TimeType t, NodeID ori, NodeID des) {
 		// If t is in the range, then simply add the edge.
 		if (range(t)) {
-			return seq[get_index(t)]->add_edge(ori,des);
+			return record(t,ori,des,-1,true,seq[get_index(t)]->add_edge(ori,des));
 		}
 		// If t=last_time+1, then advance time without change and try to add the edge.
 		else if (t==get_last_time()+1) {
 			advance_without_change();
-			return seq[get_index(t)]->add_edge(ori,des);
+			return record(t,ori,des,-1,true,seq[get_index(t)]->add_edge(ori,des));
 		}
 		else return false; // Don't do anything when t<first_time or t>last_time+1.
 	};
 	bool add_link_ID(TimeType t, NodeID ori, NodeID des, LinkID id) {
 		// If t is in the range, then simply add the edge.
 		if (range(t))
-			return seq[get_index(t)]->add_edge_ID(ori,des,id);
+			return record(t,ori,des,id,true,seq[get_index(t)]->add_edge_ID(ori,des,id));
 		// If t=last_time+1, then advance time without change and tyr to add the edge.
 		else if (t==get_last_time()+1) {
 			advance_without_change();
-			return seq[get_index(t)]->add_edge_ID(ori,des,id);
+			return record(t,ori,des,id,true,seq[get_index(t)]->add_edge_ID(ori,des,id));
 		}
 		else return false; // Don't do anything when t<first_time or t>last_time+1.
 	};
@@ -429,6 +649,64 @@ class TimeSeqGraphs {
 	};
 
    private:
+	// A change of an edge (id<0 for edges without ID).
+	struct EdgeChange {
+		NodeID ori;
+		NodeID des;
+		LinkID id;
+		bool if_add;
+	};
+
+	// Record a successful change at time t (returns if_success).
+	bool record(TimeType t, NodeID ori, NodeID des, LinkID id, bool if_add, bool if_success) {
+		if (!delta_mode || !if_success) return if_success;
+		EdgeChange ch;
+		ch.ori=ori;
+		ch.des=des;
+		ch.id=id;
+		ch.if_add=if_add;
+		deltas[get_index(t)].push_back(ch);
+		// The graph at t+1 (if exists) is not the graph at t plus its changes any more.
+		if (t<get_last_time()) if_known[get_index(t+1)]=false;
+		return if_success;
+	};
+
+	// Forget all recorded changes.
+	void forget_changes() {
+		for (unsigned long i=0;i<deltas.size();i++) deltas[i].clear();
+		if_known.assign(if_known.size(),false);
+	};
+
+	// Make the graph of the first time the same as the graph of the last time
+	//	by applying changes of later times to it (returns false if it is not possible,
+	//	or copying is cheaper).
+	bool apply_changes() {
+		if (!delta_mode) return false;
+		unsigned long nchanges=0;
+		for (long i=1;i<size;i++) {
+			long index=(first_index+i)%size;
+			if (!if_known[index]) return false;
+			nchanges+=deltas[index].size();
+		};
+		if (nchanges>(unsigned long)get_last_value()->get_edge_size()) return false;
+		Graph *gr=seq[first_index];
+		for (long i=1;i<size;i++) {
+			const std::vector<EdgeChange> &chs=deltas[(first_index+i)%size];
+			for (unsigned long j=0;j<chs.size();j++) {
+				const EdgeChange &ch=chs[j];
+				if (ch.if_add) {
+					if (ch.id<0) gr->add_edge(ch.ori,ch.des);
+					else gr->add_edge_ID(ch.ori,ch.des,ch.id);
+				}
+				else {
+					if (ch.id<0) gr->remove_edge(ch.ori,ch.des);
+					else gr->remove_edge_ID(ch.ori,ch.des,ch.id);
+				};
+			};
+		};
+		return true;
+	};
+
 	// size of the structure
 	long size;
 	// time value of the first element
@@ -437,6 +715,12 @@ class TimeSeqGraphs {
 	long first_index;
 	// data structure that contains the elements of size.
 	std::vector<Graph *> seq;
+	// If the delta mode is on.
+	bool delta_mode;
+	// Changes of edges recorded at each time (in the delta mode).
+	std::vector<std::vector<EdgeChange> > deltas;
+	// If the graph at each time is the graph at the previous time plus the recorded changes.
+	std::vector<bool> if_known;
 };
 
 }; // End of namespace conet.
@@ -0,0 +1,92 @@
+//
+//	CONETSIM - TriangleCounter.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+
+#ifndef TRIANGLECOUNTER_H
+#define TRIANGLECOUNTER_H
+
+#include "Graph.h"
+#include "SlotLists.h"
+#include "Types.h"
+#include <vector>
+
+namespace conet {
+
+// Triangles of a graph and clustering coefficients found in one pass.
+// Vertices are ordered by degree, and each edge is kept only in the list of its lower
+//	vertex, so each triangle is found once (at its lowest vertex) by intersecting two
+//	sorted lists (merging, or galloping when one list is much shorter); hubs have short
+//	lists this way. Vertices are divided among threads with OpenMP.
+// For each vertex, the number of edges between neighbors is found for all, inward and
+//	outward neighbors at the same time (the same numbers as find_neighbor_connections,
+//	find_in_neighbor_connections and find_out_neighbor_connections; multilinks and loops
+//	are ignored, and edges are directional for digraphs).
+// The graph should exist (without changes) while this object is used.
+class TriangleCounter {
+   public :
+	// Constructors (all numbers are found here); lists of outward connected vertices
+	//	can be given if they are already read (SlotLists.h).
+	TriangleCounter(const Graph &g);
+	TriangleCounter(const Graph &g, const SlotLists &out);
+
+	// Get the number of triangles (directions ignored).
+	long get_ntriangles() const {
+		return ntriangles;
+	};
+
+	// Find the number of edges between neighbors of a vertex and the number of neighbors
+	//	(dir=0: all, 1: in, 2: out). Returns -1 if the vertex doesn't exist.
+	long find_connections(NodeID v, long &degree, int dir=0) const;
+
+	// Find the clustering coefficient of a vertex (same as Graph::find_clustering_coeff_node,
+	//	find_clustering_in_coeff_node and find_clustering_out_coeff_node for dir=0, 1, 2).
+	double find_node_coeff(NodeID v, int dir=0) const;
+
+	// Find the clustering coefficient averaged over all vertices (same as
+	//	Graph::find_clustering_coeff, find_clustering_in_coeff and find_clustering_out_coeff).
+	double find_average_coeff(int dir=0) const;
+
+	// Find the global clustering coefficient (transitivity): 3*(number of triangles)/
+	//	(number of connected triples), directions ignored.
+	double find_global_coeff() const;
+
+   private:
+	// Count triangles from lists of outward connected vertices.
+	void count(const SlotLists &out);
+
+	// Coefficient from the number of connections and the degree.
+	double coeff(long connections, long degree) const {
+		if (degree>1)
+			return double(connections)*(directional? 1.0 : 2.0)/(degree*(degree-1));
+		else return 0.0;
+	};
+
+	const Graph &gr;
+	bool directional;
+	std::vector<bool> used;			// Slots used by vertices.
+	std::vector<long> degrees[3];		// Number of all, inward and outward neighbors of each slot.
+	std::vector<long> connections[3];	// Number of edges between them.
+	long ntriangles;			// Number of triangles.
+	double ntriples;			// Number of connected triples.
+};
+
+}; // End of namespace conet.
+#endif
@@ -91,8 +91,15 @@ bool initialize_random_graph3(LinkType lt, Graphs &graphs, Links &links, long fi
 // Combine two graphs (if ag is directed, then change it to undirected)
 bool combine_graphs(GraphFB &cg, const GraphFB &sg, const GraphF &ag);
 
+// Make the condensation of a graph: vertices of dag are strongly connected components
+//	of gr (labels given by Graph::find_strong_component_labels), and an edge exists
+//	when there are edges between them. (Returns the number of components.)
+long make_condensation(const Graph &gr, GraphFD &dag, std::vector<long> &labels);
+
 // Write the components (assuming components are already found as a vector).
 void write_components(const std::vector<NodeIDSSet> &components, std::ostream &of);
+// Write the components given as labels (Graph::find_component_labels) in the same format.
+void write_components(const Graph &gr, const std::vector<long> &labels, std::ostream &of);
 
 // get the max out of 2 or 3 integers.
 long find_max(long i1, long i2, long i3);
@@ -0,0 +1,101 @@
+//
+//	CONETSIM - VertexIndex.h
+//
+//
+//	Copyright (C) 2014	Suhan Ree
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+//	Author: suhanree@yahoo.com (Suhan Ree)
+
+#ifndef VERTEXINDEX_H
+#define VERTEXINDEX_H
+
+#include "Types.h"
+#include "HashIndex.h"
+#include <vector>
+
+namespace conet {
+
+// Index of vertices for graphs with varying vertices.
+// Each vertex (with its NodeID given from outside) gets an internal slot (0, 1, 2,...),
+//	so that data for vertices can be stored in vectors instead of maps.
+// Slots of removed vertices are reused (free list), while NodeIDs never change.
+class VertexIndex {
+   public :
+	// Constructor.
+	VertexIndex() : index(), ids(), free_slots() {};
+
+	// Get the number of vertices.
+	long size() const {
+		return index.size();
+	};
+
+	// Get the number of slots (used or not); slots are from 0 to get_slot_size()-1.
+	long get_slot_size() const {
+		return ids.size();
+	};
+
+	// Find the slot of a given vertex (-1 if it doesn't exist).
+	long find(NodeID v) const {
+		return index.find(v);
+	};
+
+	// Find the vertex in a given slot (-1 if the slot is not used).
+	NodeID get_ID(long slot) const {
+		return ids[slot];
+	};
+
+	// Add a vertex, and returns its slot (the existing slot if it already exists).
+	long add(NodeID v) {
+		long slot=index.find(v);
+		if (slot>=0) return slot;
+		if (free_slots.empty()) {
+			slot=ids.size();
+			ids.push_back(v);
+		}
+		else {
+			slot=free_slots.back();
+			free_slots.pop_back();
+			ids[slot]=v;
+		};
+		index.insert(v,slot);
+		return slot;
+	};
+
+	// Remove a vertex, and returns its (now free) slot (-1 if it doesn't exist).
+	long remove(NodeID v) {
+		long slot=index.find(v);
+		if (slot<0) return -1;
+		index.erase(v);
+		ids[slot]=-1;
+		free_slots.push_back(slot);
+		return slot;
+	};
+
+	// Remove all vertices.
+	void clear() {
+		index.clear();
+		ids.clear();
+		free_slots.clear();
+	};
+
+   private:
+	HashIndex index;		// NodeID -> slot.
+	std::vector<NodeID> ids;	// slot -> NodeID (-1 for free slots).
+	std::vector<long> free_slots;	// Free slots to be reused.
+};
+
+}; // End of namespace conet.
+#endif